@@ -2,6 +2,7 @@
 #include "amr-wind/turbulence/TurbulenceModel.H"
 #include "amr-wind/utilities/IOManager.H"
 #include "amr-wind/utilities/PostProcessing.H"
+#include "amr-wind/utilities/PerfMonitor.H"
 #include "amr-wind/overset/OversetManager.H"
 #include "amr-wind/core/ExtSolver.H"
 
@@ -15,6 +16,7 @@ CFDSim::CFDSim(amrex::AmrCore& mesh)
     , m_pde_mgr(*this)
     , m_io_mgr(new IOManager(*this))
     , m_post_mgr(new PostProcessManager(*this))
+    , m_perf_mon(new PerfMonitor(*this))
     , m_ext_solver_mgr(new ExtSolverMgr)
     , m_helics(new helics_storage(*this))
 {}
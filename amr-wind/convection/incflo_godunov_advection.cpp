@@ -5,6 +5,7 @@
 #include "amr-wind/convection/incflo_godunov_upwind.H"
 #include "amr-wind/convection/Godunov.H"
 #include <AMReX_Geometry.H>
+#include <AMReX_FArrayBox.H>
 
 using namespace amrex;
 
@@ -582,3 +583,55 @@ void godunov::compute_fluxes(
             }
         });
 }
+
+void godunov::compute_fluxes_tiled(
+    int lev,
+    Box const& bx,
+    int ncomp,
+    Array4<Real> const& fx,
+    Array4<Real> const& fy,
+    Array4<Real> const& fz,
+    Array4<Real const> const& q,
+    Array4<Real const> const& umac,
+    Array4<Real const> const& vmac,
+    Array4<Real const> const& wmac,
+    Array4<Real const> const& fq,
+    BCRec const* pbc,
+    int const* iconserv,
+    Vector<amrex::Geometry> geom,
+    Real dt,
+    godunov::scheme godunov_scheme,
+    IntVect const& tile_size)
+{
+    BL_PROFILE("amr-wind::godunov::compute_fluxes_tiled");
+
+    const bool use_tiles =
+        amrex::Gpu::notInLaunchRegion() && (tile_size.min() > 0);
+    if (!use_tiles) {
+        FArrayBox tmpfab(amrex::grow(bx, 1), ncomp * nscratch_fluxes);
+        compute_fluxes(
+            lev, bx, ncomp, fx, fy, fz, q, umac, vmac, wmac, fq, pbc, iconserv,
+            tmpfab.dataPtr(), geom, dt, godunov_scheme);
+        return;
+    }
+
+    const IntVect lo = bx.smallEnd();
+    const IntVect hi = bx.bigEnd();
+    const IntVect tsize = amrex::min(tile_size, bx.length());
+
+    // Working memory sized for the largest tile and reused for all tiles
+    const Box max_tile(lo, lo + tsize - 1);
+    FArrayBox tmpfab(amrex::grow(max_tile, 1), ncomp * nscratch_fluxes);
+
+    for (int kt = lo[2]; kt <= hi[2]; kt += tsize[2]) {
+        for (int jt = lo[1]; jt <= hi[1]; jt += tsize[1]) {
+            for (int it = lo[0]; it <= hi[0]; it += tsize[0]) {
+                const IntVect tlo(it, jt, kt);
+                const Box tbx(tlo, amrex::min(tlo + tsize - 1, hi));
+                compute_fluxes(
+                    lev, tbx, ncomp, fx, fy, fz, q, umac, vmac, wmac, fq, pbc,
+                    iconserv, tmpfab.dataPtr(), geom, dt, godunov_scheme);
+            }
+        }
+    }
+}
@@ -172,6 +172,7 @@ void Field::fillpatch(
     auto& fop = *(m_info->m_fillpatch_op);
 
     fop.fillpatch(lev, time, mfab, nghost, field_state());
+    m_repo.record_fillpatch(mfab, nghost, lev);
 }
 
 void Field::fillpatch_from_coarse(
@@ -196,8 +197,9 @@ void Field::fillpatch(amrex::Real time, amrex::IntVect ng) noexcept
     auto& fop = *(m_info->m_fillpatch_op);
     const int nlevels = m_repo.num_active_levels();
     for (int lev = 0; lev < nlevels; ++lev) {
-        fop.fillpatch(
-            lev, time, m_repo.get_multifab(m_id, lev), ng, field_state());
+        auto& mfab = m_repo.get_multifab(m_id, lev);
+        fop.fillpatch(lev, time, mfab, ng, field_state());
+        m_repo.record_fillpatch(mfab, ng, lev);
     }
 }
 
@@ -206,6 +208,14 @@ void Field::fillpatch(amrex::Real time) noexcept
     fillpatch(time, num_grow());
 }
 
+amrex::Interpolater* Field::fillpatch_interpolater() const noexcept
+{
+    if (!m_info->m_fillpatch_op || !m_info->bc_initialized()) {
+        return nullptr;
+    }
+    return m_info->m_fillpatch_op->interpolater();
+}
+
 void Field::fillpatch_sibling_fields(
     amrex::Real time,
     amrex::IntVect ng,
@@ -229,6 +239,9 @@ void Field::fillpatch_sibling_fields(
 
         fop.fillpatch_sibling_fields(
             lev, time, mfabs, mfabs, cfabs, ng, m_info->m_bcrec, field_state());
+        for (const auto* mf : mfabs) {
+            m_repo.record_fillpatch(*mf, ng, lev);
+        }
     }
 }
 
@@ -297,6 +310,12 @@ void Field::advance_states() noexcept
         auto& old_field = state(sold);
         auto& new_field = state(snew);
         for (int lev = 0; lev < m_repo.num_active_levels(); ++lev) {
+            // A state that was never allocated holds zeros, so there is
+            // no need to allocate the older state to copy it
+            if (!new_field.is_allocated(lev)) {
+                m_repo.release_field_data(old_field.id(), lev);
+                continue;
+            }
             amrex::MultiFab::Copy(
                 old_field(lev), new_field(lev), 0, 0, num_comp(), num_grow());
         }
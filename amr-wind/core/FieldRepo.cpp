@@ -1,9 +1,89 @@
+#include <algorithm>
+#include <iomanip>
 #include <memory>
+#include <sstream>
 
 #include "amr-wind/core/FieldRepo.H"
 
 namespace amr_wind {
 
+namespace {
+
+//! Accumulate the messages sent by this rank for a same-level exchange
+template <typename FAB>
+void record_exchange(
+    FillPatchStats& stats,
+    const amrex::FabArray<FAB>& mf,
+    const amrex::IntVect& nghost,
+    const amrex::Geometry& geom)
+{
+    if (nghost == amrex::IntVect::TheZeroVector()) {
+        return;
+    }
+    ++stats.num_exchanges;
+    if (amrex::ParallelDescriptor::NProcs() < 2) {
+        return;
+    }
+
+    const auto& fb = mf.getFB(nghost, geom.periodicity());
+    if (!fb.m_SndTags) {
+        return;
+    }
+    for (const auto& sndtags : *fb.m_SndTags) {
+        ++stats.num_messages;
+        for (const auto& tag : sndtags.second) {
+            stats.num_bytes +=
+                tag.sbox.numPts() * mf.nComp() *
+                static_cast<amrex::Long>(sizeof(typename FAB::value_type));
+        }
+    }
+}
+
+/** Fill the ghost cells of a group of fields at a level
+ *
+ *  On level 0, the same-level exchanges of all the fields are started
+ *  together and then completed together, directly on the field data, so
+ *  that the messages of all the fields are in flight at the same time. Each
+ *  field still sends its own messages, so the number of messages and bytes
+ *  is the same as for field-by-field fills; only their latencies overlap.
+ *  The physical BCs are then applied by each field's fillpatch operator,
+ *  which gives the same result as Field::fillpatch. On finer levels, the
+ *  coarse-fine interpolation is performed by the fillpatch operator of each
+ *  field, so the fields are filled one at a time.
+ */
+void fillpatch_overlapped(
+    const amrex::AmrCore& mesh,
+    const amrex::Vector<Field*>& fields,
+    const int lev,
+    const amrex::Real time,
+    FillPatchStats& stats)
+{
+    const auto& geom = mesh.Geom(lev);
+    if (lev > 0) {
+        // Field::fillpatch records the exchange
+        for (auto* fld : fields) {
+            fld->fillpatch(lev, time, (*fld)(lev), fld->num_grow());
+        }
+        return;
+    }
+
+    const auto& nghost = fields[0]->num_grow();
+    for (auto* fld : fields) {
+        auto& mf = (*fld)(lev);
+        mf.FillBoundary_nowait(0, fld->num_comp(), nghost, geom.periodicity());
+    }
+    for (auto* fld : fields) {
+        (*fld)(lev).FillBoundary_finish();
+    }
+    for (auto* fld : fields) {
+        fld->fillphysbc(lev, time, (*fld)(lev), nghost);
+        record_exchange(stats, (*fld)(lev), nghost, geom);
+    }
+    stats.num_overlapped += static_cast<int>(fields.size());
+}
+
+} // namespace
+
 LevelDataHolder::LevelDataHolder()
     : m_factory(new amrex::FArrayBoxFactory())
     , m_int_fact(new amrex::DefaultFabFactory<amrex::IArrayBox>())
@@ -22,6 +102,7 @@ void FieldRepo::make_new_level_from_scratch(
         ba, dm, *m_leveldata[lev], *(m_leveldata[lev]->m_factory));
     allocate_field_data(
         ba, dm, *m_leveldata[lev], *(m_leveldata[lev]->m_int_fact));
+    reset_level_flags(lev);
 
     m_is_initialized = true;
 }
@@ -47,6 +128,7 @@ void FieldRepo::make_new_level_from_coarse(
     }
 
     m_leveldata[lev] = std::move(ldata);
+    reset_level_flags(lev);
     m_is_initialized = true;
 }
 
@@ -71,6 +153,7 @@ void FieldRepo::remake_level(
     }
 
     m_leveldata[lev] = std::move(ldata);
+    reset_level_flags(lev);
     m_is_initialized = true;
 }
 
@@ -78,6 +161,7 @@ void FieldRepo::clear_level(int lev)
 {
     BL_PROFILE("amr-wind::FieldRepo::clear_level");
     m_leveldata[lev].reset();
+    reset_level_flags(lev);
 }
 
 Field& FieldRepo::declare_field(
@@ -342,6 +426,177 @@ void FieldRepo::advance_states() noexcept
     }
 }
 
+void FieldRepo::fillpatch_fields(
+    const amrex::Vector<Field*>& fields,
+    const amrex::Real time,
+    const bool overlap)
+{
+    BL_PROFILE("amr-wind::FieldRepo::fillpatch_fields");
+
+    // Group the fields whose exchanges can be overlapped
+    struct FieldGroup
+    {
+        FieldLoc floc;
+        amrex::IntVect nghost;
+        amrex::Interpolater* mapper;
+        amrex::Vector<Field*> fields;
+    };
+    amrex::Vector<FieldGroup> groups;
+    for (auto* fld : fields) {
+        auto* mapper = overlap ? fld->fillpatch_interpolater() : nullptr;
+        auto grp = std::find_if(
+            groups.begin(), groups.end(), [&](const FieldGroup& g) {
+                return (mapper != nullptr) && (g.mapper == mapper) &&
+                       (g.floc == fld->field_location()) &&
+                       (g.nghost == fld->num_grow());
+            });
+        if (grp == groups.end()) {
+            groups.push_back(
+                {fld->field_location(), fld->num_grow(), mapper, {fld}});
+        } else {
+            grp->fields.push_back(fld);
+        }
+    }
+
+    const int nlevels = num_active_levels();
+    for (const auto& grp : groups) {
+        if (grp.fields.size() > 1) {
+            for (int lev = 0; lev < nlevels; ++lev) {
+                fillpatch_overlapped(
+                    m_mesh, grp.fields, lev, time, m_fillpatch_stats);
+            }
+            continue;
+        }
+
+        grp.fields[0]->fillpatch(time);
+    }
+}
+
+void FieldRepo::record_fillpatch(
+    const amrex::MultiFab& mfab, const amrex::IntVect& nghost, const int lev)
+{
+    record_exchange(m_fillpatch_stats, mfab, nghost, m_mesh.Geom(lev));
+}
+
+void FieldRepo::allocate_deferred_data(
+    const unsigned fid, const int lev) noexcept
+{
+    auto& field = *m_field_vec[fid];
+    auto& ldata = *m_leveldata[lev];
+
+    // The first access to a field can happen within a parallel region, so
+    // only one thread allocates the data
+#ifdef AMREX_USE_OMP
+#pragma omp critical(amr_wind_allocate_deferred_data)
+#endif
+    {
+        if (!field.is_allocated(lev)) {
+            const auto ba = amrex::convert(
+                m_mesh.boxArray(lev),
+                field_impl::index_type(field.field_location()));
+            auto& mfab = ldata.m_mfabs[fid];
+            mfab.define(
+                ba, m_mesh.DistributionMap(lev), field.num_comp(),
+                field.num_grow(), amrex::MFInfo(), *ldata.m_factory);
+            mfab.setVal(0.0);
+
+            field.m_unallocated_levels.fetch_and(
+                ~(1U << lev), std::memory_order_release);
+        }
+    }
+}
+
+void FieldRepo::release_field_data(const unsigned fid, const int lev) noexcept
+{
+    auto& field = *m_field_vec[fid];
+    auto& ldata = *m_leveldata[lev];
+    const unsigned bit = 1U << lev;
+
+    ldata.m_mfabs[fid].clear();
+    field.m_unallocated_levels.fetch_or(bit, std::memory_order_release);
+}
+
+void FieldRepo::reset_level_flags(const int lev) noexcept
+{
+    const unsigned bit = 1U << lev;
+    for (auto& field : m_field_vec) {
+        const bool unallocated =
+            m_leveldata[lev] &&
+            !m_leveldata[lev]->m_mfabs[field->id()].isDefined();
+        if (unallocated) {
+            field->m_unallocated_levels.fetch_or(
+                bit, std::memory_order_release);
+        } else {
+            field->m_unallocated_levels.fetch_and(
+                ~bit, std::memory_order_release);
+        }
+    }
+}
+
+amrex::Long
+FieldRepo::memory_usage(const Field& field, const int lev) const noexcept
+{
+    if (!field.is_allocated(lev)) {
+        return 0;
+    }
+
+    const auto& ba = m_leveldata[lev]->m_mfabs[field.id()].boxArray();
+    const auto nghost = field.num_grow();
+    amrex::Long npts = 0;
+    for (int i = 0; i < static_cast<int>(ba.size()); ++i) {
+        npts += amrex::grow(ba[i], nghost).numPts();
+    }
+    return npts * field.num_comp() *
+           static_cast<amrex::Long>(sizeof(amrex::Real));
+}
+
+void FieldRepo::print_memory_report() const
+{
+    BL_PROFILE("amr-wind::FieldRepo::print_memory_report");
+    const int nlevels = num_active_levels();
+    constexpr double to_mb = 1.0 / (1024.0 * 1024.0);
+
+    std::ostringstream os;
+    os << "Field memory report (MB, all ranks; '-' = not allocated)"
+       << std::endl
+       << std::setw(36) << std::left << "field";
+    for (int lev = 0; lev < nlevels; ++lev) {
+        os << std::setw(12) << std::right << ("level " + std::to_string(lev));
+    }
+    os << std::setw(12) << std::right << "total" << std::endl;
+
+    amrex::Vector<amrex::Long> level_totals(nlevels + 1, 0);
+    os << std::fixed << std::setprecision(2);
+    for (const auto& field : m_field_vec) {
+        os << std::setw(36) << std::left << field->name();
+        amrex::Long total = 0;
+        for (int lev = 0; lev < nlevels; ++lev) {
+            const auto nbytes = memory_usage(*field, lev);
+            total += nbytes;
+            level_totals[lev] += nbytes;
+            std::string val = "-";
+            if (field->is_allocated(lev)) {
+                std::ostringstream vs;
+                vs << std::fixed << std::setprecision(2)
+                   << static_cast<double>(nbytes) * to_mb;
+                val = vs.str();
+            }
+            os << std::setw(12) << std::right << val;
+        }
+        level_totals[nlevels] += total;
+        os << std::setw(12) << std::right
+           << static_cast<double>(total) * to_mb << std::endl;
+    }
+    os << std::setw(36) << std::left << "total";
+    for (const auto nbytes : level_totals) {
+        os << std::setw(12) << std::right
+           << static_cast<double>(nbytes) * to_mb;
+    }
+    os << std::endl;
+
+    amrex::Print() << os.str() << std::endl;
+}
+
 void FieldRepo::allocate_field_data(
     const amrex::BoxArray& ba,
     const amrex::DistributionMapping& dm,
@@ -351,10 +606,17 @@ void FieldRepo::allocate_field_data(
     auto& mfab_vec = level_data.m_mfabs;
 
     for (auto& field : m_field_vec) {
+        mfab_vec.emplace_back();
+
+        // Defer the allocation of fields that are not interpolated
+        if (m_lazy_alloc && !field->fillpatch_on_regrid()) {
+            continue;
+        }
+
         auto ba1 =
             amrex::convert(ba, field_impl::index_type(field->field_location()));
 
-        mfab_vec.emplace_back(
+        mfab_vec.back().define(
             ba1, dm, field->num_comp(), field->num_grow(), amrex::MFInfo(),
             factory);
 
@@ -364,16 +626,23 @@ void FieldRepo::allocate_field_data(
 
 void FieldRepo::allocate_field_data(
     int lev,
-    const Field& field,
+    Field& field,
     LevelDataHolder& level_data,
     const amrex::FabFactory<amrex::FArrayBox>& factory)
 {
     auto& mfab_vec = level_data.m_mfabs;
     AMREX_ASSERT(mfab_vec.size() == field.id());
+    mfab_vec.emplace_back();
+    if (m_lazy_alloc) {
+        field.m_unallocated_levels.fetch_or(
+            1U << lev, std::memory_order_release);
+        return;
+    }
+
     const auto ba = amrex::convert(
         m_mesh.boxArray(lev), field_impl::index_type(field.field_location()));
 
-    mfab_vec.emplace_back(
+    mfab_vec.back().define(
         ba, m_mesh.DistributionMap(lev), field.num_comp(), field.num_grow(),
         amrex::MFInfo(), factory);
 
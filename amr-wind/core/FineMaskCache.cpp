@@ -0,0 +1,114 @@
+#include "amr-wind/core/FineMaskCache.H"
+
+#include "AMReX_MultiFabUtil.H"
+
+namespace amr_wind {
+
+FineMaskCache::FineMaskCache(const amrex::AmrCore& mesh) : m_mesh(mesh) {}
+
+void FineMaskCache::invalidate() { m_levels.clear(); }
+
+FineMaskCache::LevelData& FineMaskCache::level_data(const int lev)
+{
+    const int nlevels = m_mesh.finestLevel() + 1;
+    AMREX_ALWAYS_ASSERT(lev < nlevels);
+    if (static_cast<int>(m_levels.size()) != nlevels) {
+        m_levels.resize(nlevels);
+    }
+
+    const auto& ba = m_mesh.boxArray(lev);
+    const auto& dm = m_mesh.DistributionMap(lev);
+    const auto fba =
+        (lev < nlevels - 1) ? m_mesh.boxArray(lev + 1) : amrex::BoxArray();
+
+    auto& ldata = m_levels[lev];
+    if ((ldata.ba != ba) || (ldata.dm != dm) || (ldata.fine_ba != fba)) {
+        ldata = LevelData();
+        ldata.ba = ba;
+        ldata.dm = dm;
+        ldata.fine_ba = fba;
+    }
+    return ldata;
+}
+
+const amrex::iMultiFab& FineMaskCache::cell_mask(const int lev)
+{
+    auto& ldata = level_data(lev);
+    if (ldata.cell_mask.ok()) {
+        return ldata.cell_mask;
+    }
+
+    BL_PROFILE("amr-wind::FineMaskCache::cell_mask");
+    if (ldata.fine_ba.empty()) {
+        ldata.cell_mask.define(ldata.ba, ldata.dm, 1, 0);
+        ldata.cell_mask.setVal(1);
+    } else {
+        ldata.cell_mask = amrex::makeFineMask(
+            ldata.ba, ldata.dm, ldata.fine_ba, m_mesh.refRatio(lev), 1, 0);
+    }
+    ++m_num_builds;
+    return ldata.cell_mask;
+}
+
+const amrex::iMultiFab& FineMaskCache::node_mask(const int lev)
+{
+    auto& ldata = level_data(lev);
+    if (ldata.node_mask.ok()) {
+        return ldata.node_mask;
+    }
+
+    BL_PROFILE("amr-wind::FineMaskCache::node_mask");
+    const auto nd_ba =
+        amrex::convert(ldata.ba, amrex::IntVect::TheNodeVector());
+    if (ldata.fine_ba.empty()) {
+        ldata.node_mask.define(nd_ba, ldata.dm, 1, 0);
+        ldata.node_mask.setVal(1);
+    } else {
+        // Coarsen the fine grids first so that the nodes on the boundary of
+        // the fine level are covered
+        const auto nd_fba = amrex::convert(
+            amrex::coarsen(ldata.fine_ba, m_mesh.refRatio(lev)),
+            amrex::IntVect::TheNodeVector());
+        ldata.node_mask = amrex::makeFineMask(
+            nd_ba, ldata.dm, nd_fba, amrex::IntVect(1), 1, 0);
+    }
+    ++m_num_builds;
+    return ldata.node_mask;
+}
+
+const amrex::Vector<UncoveredTile>&
+FineMaskCache::uncovered_tiles(const int lev)
+{
+    auto& ldata = level_data(lev);
+    if (ldata.has_tiles) {
+        return ldata.tiles;
+    }
+
+    BL_PROFILE("amr-wind::FineMaskCache::uncovered_tiles");
+    const auto cfba = ldata.fine_ba.empty()
+                          ? amrex::BoxArray()
+                          : amrex::coarsen(ldata.fine_ba, m_mesh.refRatio(lev));
+
+    // Only the metadata is needed to iterate over the tiles
+    const amrex::iMultiFab layout(
+        ldata.ba, ldata.dm, 1, 0, amrex::MFInfo().SetAlloc(false));
+    for (amrex::MFIter mfi(layout, amrex::TilingIfNotGPU()); mfi.isValid();
+         ++mfi) {
+        const auto& bx = mfi.tilebox();
+        amrex::Long ncovered = 0;
+        if (!cfba.empty()) {
+            // The boxes of the finer level do not overlap
+            for (const auto& isect : cfba.intersections(bx)) {
+                ncovered += isect.second.numPts();
+            }
+        }
+        if (ncovered < bx.numPts()) {
+            ldata.tiles.push_back({bx, mfi.index(), ncovered > 0});
+        }
+    }
+    ldata.has_tiles = true;
+    ++m_num_builds;
+    return ldata.tiles;
+}
+
+} // namespace amr_wind
@@ -1,10 +1,27 @@
 #include "amr-wind/core/SimTime.H"
 
 #include "AMReX_ParmParse.H"
+#include "AMReX_ParallelDescriptor.H"
 #include "AMReX_Print.H"
+#include "AMReX_Utility.H"
+
+#include <csignal>
+#include <cstdio>
 
 namespace amr_wind {
 
+namespace {
+
+//! Set asynchronously when the process receives a checkpoint request
+volatile std::sig_atomic_t checkpoint_signal_received = 0;
+
+extern "C" void handle_checkpoint_signal(int /* signum */)
+{
+    checkpoint_signal_received = 1;
+}
+
+} // namespace
+
 void SimTime::parse_parameters()
 {
     // Initialize deltaT to negative values
@@ -28,12 +45,38 @@ void SimTime::parse_parameters()
     pp.query("plot_start", m_plt_start_index);
     pp.query("checkpoint_start", m_chkpt_start_index);
     pp.query("use_force_cfl", m_use_force_cfl);
+    pp.query("plot_walltime_interval", m_plt_wall_interval);
+    pp.query("checkpoint_walltime_interval", m_chkpt_wall_interval);
+    pp.query("max_walltime", m_max_walltime);
+    pp.query("walltime_margin", m_walltime_margin);
+    pp.query("plot_cfl_threshold", m_plt_cfl_threshold);
+    pp.query("checkpoint_cfl_threshold", m_chkpt_cfl_threshold);
+    pp.query("checkpoint_trigger_file", m_chkpt_trigger_file);
+    pp.query("checkpoint_on_signal", m_chkpt_on_signal);
 
     if (m_fixed_dt > 0.0) {
         m_dt[0] = m_fixed_dt;
     } else {
         m_adaptive = true;
     }
+
+    m_wall_start = amrex::ParallelDescriptor::second();
+    m_wall_step_start = m_wall_start;
+    m_wall_last_plt = m_wall_start;
+    m_wall_last_chkpt = m_wall_start;
+
+    if (m_chkpt_on_signal) {
+        install_signal_handler();
+    }
+}
+
+void SimTime::install_signal_handler() const
+{
+#ifdef SIGUSR1
+    std::signal(SIGUSR1, handle_checkpoint_signal);
+#else
+    amrex::Abort("time.checkpoint_on_signal: SIGUSR1 is not available");
+#endif
 }
 
 bool SimTime::new_timestep()
@@ -72,6 +115,7 @@ bool SimTime::new_timestep()
         m_time_index++;
         m_cur_time = m_new_time;
         m_new_time += m_dt[0];
+        m_wall_step_start = amrex::ParallelDescriptor::second();
 
         // clang-format off
         if (m_verbose >= 0) {
@@ -179,6 +223,10 @@ bool SimTime::continue_simulation() const
         return stop_simulation;
     }
 
+    if (m_stop_requested) {
+        return stop_simulation;
+    }
+
     if ((m_stop_time > 0.0) && ((m_new_time + eps) >= m_stop_time)) {
         return stop_simulation;
     }
@@ -201,31 +249,112 @@ bool SimTime::do_regrid() const
 bool SimTime::write_plot_file() const
 {
     return (
-        (m_plt_interval > 0) &&
-        ((m_time_index - m_plt_start_index) % m_plt_interval == 0));
+        m_plt_triggered ||
+        ((m_plt_interval > 0) &&
+         ((m_time_index - m_plt_start_index) % m_plt_interval == 0)));
 }
 
 bool SimTime::write_checkpoint() const
 {
     return (
-        (m_chkpt_interval > 0) &&
-        ((m_time_index - m_chkpt_start_index) % m_chkpt_interval == 0));
+        m_chkpt_triggered ||
+        ((m_chkpt_interval > 0) &&
+         ((m_time_index - m_chkpt_start_index) % m_chkpt_interval == 0)));
 }
 
 bool SimTime::write_last_plot_file() const
 {
     return (
-        (m_plt_interval > 0) &&
+        (m_plt_interval > 0) && (m_last_plt_index != m_time_index) &&
         ((m_time_index - m_plt_start_index) % m_plt_interval != 0));
 }
 
 bool SimTime::write_last_checkpoint() const
 {
     return (
-        (m_chkpt_interval > 0) &&
+        (m_chkpt_interval > 0) && (m_last_chkpt_index != m_time_index) &&
         ((m_time_index - m_chkpt_start_index) % m_chkpt_interval != 0));
 }
 
+void SimTime::update_output_triggers()
+{
+    // Triggers based on the CFL fire once when the CFL rises above the
+    // threshold, and are re-armed when it drops below the threshold again.
+    const bool plt_cfl =
+        (m_plt_cfl_threshold > 0.0) && (m_current_cfl > m_plt_cfl_threshold);
+    const bool chkpt_cfl = (m_chkpt_cfl_threshold > 0.0) &&
+                           (m_current_cfl > m_chkpt_cfl_threshold);
+    m_plt_triggered = plt_cfl && !m_plt_cfl_exceeded;
+    m_chkpt_triggered = chkpt_cfl && !m_chkpt_cfl_exceeded;
+    m_plt_cfl_exceeded = plt_cfl;
+    m_chkpt_cfl_exceeded = chkpt_cfl;
+
+    const bool check_wall_clock = (m_plt_wall_interval > 0.0) ||
+                                  (m_chkpt_wall_interval > 0.0) ||
+                                  (m_max_walltime > 0.0);
+    const bool check_external =
+        !m_chkpt_trigger_file.empty() || m_chkpt_on_signal;
+    if (check_wall_clock || check_external) {
+        const amrex::Real now = amrex::ParallelDescriptor::second();
+        const amrex::Real step_time = now - m_wall_step_start;
+
+        // The clocks and the signals are not synchronized across ranks, so
+        // the decisions are combined to ensure all ranks take part in the I/O
+        enum { Plot = 0, Checkpoint, External, Stop, NumFlags };
+        int flags[NumFlags]{0};
+        flags[Plot] = static_cast<int>(
+            (m_plt_wall_interval > 0.0) &&
+            ((now - m_wall_last_plt) >= m_plt_wall_interval));
+        flags[Checkpoint] = static_cast<int>(
+            (m_chkpt_wall_interval > 0.0) &&
+            ((now - m_wall_last_chkpt) >= m_chkpt_wall_interval));
+        // Stop if the next timestep might not finish within the budget
+        flags[Stop] = static_cast<int>(
+            (m_max_walltime > 0.0) &&
+            ((now - m_wall_start + step_time + m_walltime_margin) >=
+             m_max_walltime));
+        if (checkpoint_signal_received != 0) {
+            checkpoint_signal_received = 0;
+            flags[External] = 1;
+        }
+        if (!m_chkpt_trigger_file.empty() &&
+            amrex::ParallelDescriptor::IOProcessor() &&
+            amrex::FileExists(m_chkpt_trigger_file)) {
+            // Remove the file so that each request produces one checkpoint
+            std::remove(m_chkpt_trigger_file.c_str());
+            flags[External] = 1;
+        }
+        amrex::ParallelDescriptor::ReduceIntMax(flags, NumFlags);
+
+        m_plt_triggered = m_plt_triggered || (flags[Plot] != 0);
+        m_chkpt_triggered = m_chkpt_triggered || (flags[Checkpoint] != 0) ||
+                            (flags[External] != 0) || (flags[Stop] != 0);
+        m_stop_requested = (flags[Stop] != 0);
+
+        if (m_verbose >= 0) {
+            if (flags[External] != 0) {
+                amrex::Print() << "Checkpoint requested at step "
+                               << m_time_index << std::endl;
+            }
+            if (m_stop_requested) {
+                amrex::Print()
+                    << "Wall-clock budget of " << m_max_walltime
+                    << " s. reached; writing checkpoint and stopping at step "
+                    << m_time_index << std::endl;
+            }
+        }
+    }
+
+    if (write_plot_file()) {
+        m_last_plt_index = m_time_index;
+        m_wall_last_plt = amrex::ParallelDescriptor::second();
+    }
+    if (write_checkpoint()) {
+        m_last_chkpt_index = m_time_index;
+        m_wall_last_chkpt = amrex::ParallelDescriptor::second();
+    }
+}
+
 void SimTime::set_restart_time(int tidx, amrex::Real time)
 {
     m_time_index = tidx;
@@ -23,6 +23,7 @@ PDEMgr::PDEMgr(CFDSim& sim) : m_sim(sim)
     amrex::ParmParse pp("incflo");
     pp.query("use_godunov", m_use_godunov);
     pp.query("constant_density", m_constant_density);
+    pp.query("overlap_fillpatch", m_overlap_fillpatch);
 
     m_scheme =
         m_use_godunov ? fvm::Godunov::scheme_name() : fvm::MOL::scheme_name();
@@ -75,14 +76,17 @@ void PDEMgr::advance_states()
 void PDEMgr::fillpatch_state_fields(
     const amrex::Real time, const FieldState fstate)
 {
+    amrex::Vector<Field*> fields;
     if (m_constant_density) {
-        m_sim.repo().get_field("density").state(fstate).fillpatch(time);
+        fields.push_back(&m_sim.repo().get_field("density").state(fstate));
     }
 
-    icns().fields().field.state(fstate).fillpatch(time);
+    fields.push_back(&icns().fields().field.state(fstate));
     for (auto& eqn : scalar_eqns()) {
-        eqn->fields().field.state(fstate).fillpatch(time);
+        fields.push_back(&eqn->fields().field.state(fstate));
     }
+
+    m_sim.repo().fillpatch_fields(fields, time, m_overlap_fillpatch);
 }
 
 } // namespace amr_wind::pde
@@ -1,4 +1,5 @@
 #include "amr-wind/equation_systems/icns/source_terms/ABLForcing.H"
+#include "amr-wind/equation_systems/FusedSourceTerms.H"
 #include "amr-wind/CFDSim.H"
 #include "amr-wind/wind_energy/ABL.H"
 #include "amr-wind/utilities/trig_ops.H"
@@ -47,23 +48,25 @@ ABLForcing::ABLForcing(const CFDSim& sim) : m_time(sim.time())
 
 ABLForcing::~ABLForcing() = default;
 
-void ABLForcing::operator()(
+ABLForcing::DeviceOp ABLForcing::device_op(
     const int /*lev*/,
     const amrex::MFIter& /*mfi*/,
+    const FieldState /*fstate*/) const
+{
+    DeviceOp op;
+    op.dudt = m_abl_forcing[0];
+    op.dvdt = m_abl_forcing[1];
+    return op;
+}
+
+void ABLForcing::operator()(
+    const int lev,
+    const amrex::MFIter& mfi,
     const amrex::Box& bx,
-    const FieldState /*fstate*/,
+    const FieldState fstate,
     const amrex::Array4<amrex::Real>& src_term) const
 {
-
-    const amrex::Real dudt = m_abl_forcing[0];
-    const amrex::Real dvdt = m_abl_forcing[1];
-
-    amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-        src_term(i, j, k, 0) += dudt;
-        src_term(i, j, k, 1) += dvdt;
-
-        // No forcing in z-direction
-    });
+    apply_source_op<AMREX_SPACEDIM>(bx, device_op(lev, mfi, fstate), src_term);
 }
 
 } // namespace amr_wind::pde::icns
@@ -1,4 +1,5 @@
 #include "amr-wind/equation_systems/icns/source_terms/BodyForce.H"
+#include "amr-wind/equation_systems/FusedSourceTerms.H"
 #include "amr-wind/CFDSim.H"
 #include "amr-wind/utilities/trig_ops.H"
 
@@ -24,25 +25,26 @@ BodyForce::BodyForce(const CFDSim& sim) : m_time(sim.time())
 
 BodyForce::~BodyForce() = default;
 
-void BodyForce::operator()(
+BodyForce::DeviceOp BodyForce::device_op(
     const int /*lev*/,
     const amrex::MFIter& /*mfi*/,
-    const amrex::Box& bx,
-    const FieldState /*fstate*/,
-    const amrex::Array4<amrex::Real>& src_term) const
+    const FieldState /*fstate*/) const
 {
     const auto& time = m_time.current_time();
-    amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> forcing{
-        {m_body_force[0], m_body_force[1], m_body_force[2]}};
-
-    amrex::Real coeff =
-        (m_type == "oscillatory") ? std::cos(m_omega * time) : 1.0;
+    DeviceOp op;
+    op.forcing = {{m_body_force[0], m_body_force[1], m_body_force[2]}};
+    op.coeff = (m_type == "oscillatory") ? std::cos(m_omega * time) : 1.0;
+    return op;
+}
 
-    amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-        src_term(i, j, k, 0) += coeff * forcing[0];
-        src_term(i, j, k, 1) += coeff * forcing[1];
-        src_term(i, j, k, 2) += coeff * forcing[2];
-    });
+void BodyForce::operator()(
+    const int lev,
+    const amrex::MFIter& mfi,
+    const amrex::Box& bx,
+    const FieldState fstate,
+    const amrex::Array4<amrex::Real>& src_term) const
+{
+    apply_source_op<AMREX_SPACEDIM>(bx, device_op(lev, mfi, fstate), src_term);
 }
 
 } // namespace amr_wind::pde::icns
@@ -1,4 +1,5 @@
 #include "amr-wind/equation_systems/icns/source_terms/BoussinesqBuoyancy.H"
+#include "amr-wind/equation_systems/FusedSourceTerms.H"
 #include "amr-wind/CFDSim.H"
 #include "amr-wind/core/FieldUtils.H"
 
@@ -34,6 +35,19 @@ BoussinesqBuoyancy::BoussinesqBuoyancy(const CFDSim& sim)
 
 BoussinesqBuoyancy::~BoussinesqBuoyancy() = default;
 
+BoussinesqBuoyancy::DeviceOp BoussinesqBuoyancy::device_op(
+    const int lev, const amrex::MFIter& mfi, const FieldState fstate) const
+{
+    DeviceOp op;
+    op.T0 = m_ref_theta;
+    op.beta = m_beta;
+    op.gravity = {{m_gravity[0], m_gravity[1], m_gravity[2]}};
+    op.temp =
+        m_temperature.state(field_impl::phi_state(fstate))(lev).const_array(
+            mfi);
+    return op;
+}
+
 void BoussinesqBuoyancy::operator()(
     const int lev,
     const amrex::MFIter& mfi,
@@ -41,22 +55,7 @@ void BoussinesqBuoyancy::operator()(
     const FieldState fstate,
     const amrex::Array4<amrex::Real>& src_term) const
 {
-    const amrex::Real T0 = m_ref_theta;
-    const amrex::Real beta = m_beta;
-    const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> gravity{
-        {m_gravity[0], m_gravity[1], m_gravity[2]}};
-
-    const auto& temp =
-        m_temperature.state(field_impl::phi_state(fstate))(lev).const_array(
-            mfi);
-    amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-        const amrex::Real T = temp(i, j, k, 0);
-        const amrex::Real fac = beta * (T0 - T);
-
-        src_term(i, j, k, 0) += gravity[0] * fac;
-        src_term(i, j, k, 1) += gravity[1] * fac;
-        src_term(i, j, k, 2) += gravity[2] * fac;
-    });
+    apply_source_op<AMREX_SPACEDIM>(bx, device_op(lev, mfi, fstate), src_term);
 }
 
 } // namespace amr_wind::pde::icns
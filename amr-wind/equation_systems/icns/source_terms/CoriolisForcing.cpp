@@ -1,4 +1,5 @@
 #include "amr-wind/equation_systems/icns/source_terms/CoriolisForcing.H"
+#include "amr-wind/equation_systems/FusedSourceTerms.H"
 #include "amr-wind/CFDSim.H"
 #include "amr-wind/utilities/tensor_ops.H"
 #include "amr-wind/utilities/trig_ops.H"
@@ -50,6 +51,21 @@ CoriolisForcing::CoriolisForcing(const CFDSim& sim)
 
 CoriolisForcing::~CoriolisForcing() = default;
 
+CoriolisForcing::DeviceOp CoriolisForcing::device_op(
+    const int lev, const amrex::MFIter& mfi, const FieldState fstate) const
+{
+    DeviceOp op;
+    op.east = {{m_east[0], m_east[1], m_east[2]}};
+    op.north = {{m_north[0], m_north[1], m_north[2]}};
+    op.up = {{m_up[0], m_up[1], m_up[2]}};
+    op.sinphi = m_sinphi;
+    op.cosphi = m_cosphi;
+    op.corfac = m_coriolis_factor;
+    op.vel =
+        m_velocity.state(field_impl::dof_state(fstate))(lev).const_array(mfi);
+    return op;
+}
+
 void CoriolisForcing::operator()(
     const int lev,
     const amrex::MFIter& mfi,
@@ -57,42 +73,7 @@ void CoriolisForcing::operator()(
     const FieldState fstate,
     const amrex::Array4<amrex::Real>& src_term) const
 {
-    amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> east{
-        {m_east[0], m_east[1], m_east[2]}};
-    amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> north{
-        {m_north[0], m_north[1], m_north[2]}};
-    amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> up{
-        {m_up[0], m_up[1], m_up[2]}};
-
-    const auto sinphi = m_sinphi;
-    const auto cosphi = m_cosphi;
-    const auto corfac = m_coriolis_factor;
-    const auto& vel =
-        m_velocity.state(field_impl::dof_state(fstate))(lev).const_array(mfi);
-
-    amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-        const amrex::Real ue = east[0] * vel(i, j, k, 0) +
-                               east[1] * vel(i, j, k, 1) +
-                               east[2] * vel(i, j, k, 2);
-        const amrex::Real un = north[0] * vel(i, j, k, 0) +
-                               north[1] * vel(i, j, k, 1) +
-                               north[2] * vel(i, j, k, 2);
-        const amrex::Real uu = up[0] * vel(i, j, k, 0) +
-                               up[1] * vel(i, j, k, 1) +
-                               up[2] * vel(i, j, k, 2);
-
-        const amrex::Real ae = +corfac * (un * sinphi - uu * cosphi);
-        const amrex::Real an = -corfac * ue * sinphi;
-        const amrex::Real au = +corfac * ue * cosphi;
-
-        const amrex::Real ax = ae * east[0] + an * north[0] + au * up[0];
-        const amrex::Real ay = ae * east[1] + an * north[1] + au * up[1];
-        const amrex::Real az = ae * east[2] + an * north[2] + au * up[2];
-
-        src_term(i, j, k, 0) += ax;
-        src_term(i, j, k, 1) += ay;
-        src_term(i, j, k, 2) += az;
-    });
+    apply_source_op<AMREX_SPACEDIM>(bx, device_op(lev, mfi, fstate), src_term);
 }
 
 } // namespace amr_wind::pde::icns
@@ -1,4 +1,5 @@
 #include "amr-wind/equation_systems/icns/source_terms/GeostrophicForcing.H"
+#include "amr-wind/equation_systems/FusedSourceTerms.H"
 #include "amr-wind/CFDSim.H"
 #include "amr-wind/utilities/trig_ops.H"
 #include "amr-wind/core/vs/vstraits.H"
@@ -52,20 +53,24 @@ GeostrophicForcing::GeostrophicForcing(const CFDSim& /*unused*/)
 
 GeostrophicForcing::~GeostrophicForcing() = default;
 
-void GeostrophicForcing::operator()(
+GeostrophicForcing::DeviceOp GeostrophicForcing::device_op(
     const int /*lev*/,
     const amrex::MFIter& /*mfi*/,
+    const FieldState /*fstate*/) const
+{
+    DeviceOp op;
+    op.forcing = {{m_g_forcing[0], m_g_forcing[1], m_g_forcing[2]}};
+    return op;
+}
+
+void GeostrophicForcing::operator()(
+    const int lev,
+    const amrex::MFIter& mfi,
     const amrex::Box& bx,
-    const FieldState /*fstate*/,
+    const FieldState fstate,
     const amrex::Array4<amrex::Real>& src_term) const
 {
-    amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> forcing{
-        {m_g_forcing[0], m_g_forcing[1], m_g_forcing[2]}};
-    amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-        src_term(i, j, k, 0) += forcing[0];
-        src_term(i, j, k, 1) += forcing[1];
-        // No forcing in z-direction
-    });
+    apply_source_op<AMREX_SPACEDIM>(bx, device_op(lev, mfi, fstate), src_term);
 }
 
 } // namespace amr_wind::pde::icns
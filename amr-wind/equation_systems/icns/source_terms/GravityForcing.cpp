@@ -1,4 +1,5 @@
 #include "amr-wind/equation_systems/icns/source_terms/GravityForcing.H"
+#include "amr-wind/equation_systems/FusedSourceTerms.H"
 #include "amr-wind/CFDSim.H"
 #include "amr-wind/core/FieldUtils.H"
 
@@ -29,20 +30,24 @@ GravityForcing::~GravityForcing() = default;
  *  @param vel_forces Forcing source term
  */
 void GravityForcing::operator()(
-    const int /*lev*/,
-    const amrex::MFIter& /*mfi*/,
+    const int lev,
+    const amrex::MFIter& mfi,
     const amrex::Box& bx,
-    const FieldState /*fstate*/,
+    const FieldState fstate,
     const amrex::Array4<amrex::Real>& vel_forces) const
 {
-    const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> gravity{
-        {m_gravity[0], m_gravity[1], m_gravity[2]}};
+    apply_source_op<AMREX_SPACEDIM>(
+        bx, device_op(lev, mfi, fstate), vel_forces);
+}
 
-    amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-        vel_forces(i, j, k, 0) += gravity[0];
-        vel_forces(i, j, k, 1) += gravity[1];
-        vel_forces(i, j, k, 2) += gravity[2];
-    });
+GravityForcing::DeviceOp GravityForcing::device_op(
+    const int /*lev*/,
+    const amrex::MFIter& /*mfi*/,
+    const FieldState /*fstate*/) const
+{
+    DeviceOp op;
+    op.gravity = {{m_gravity[0], m_gravity[1], m_gravity[2]}};
+    return op;
 }
 
 } // namespace amr_wind::pde::icns
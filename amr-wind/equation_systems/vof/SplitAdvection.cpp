@@ -22,7 +22,8 @@ void multiphase::split_advection_step(
     amrex::GpuArray<BC, AMREX_SPACEDIM * 2> BCs,
     amrex::Vector<amrex::Geometry> geom,
     amrex::Real dt,
-    bool rm_debris)
+    bool rm_debris,
+    bool banded)
 {
     BL_PROFILE("amr-wind::multiphase::split_advection_step");
 
@@ -38,8 +39,6 @@ void multiphase::split_advection_step(
         for (amrex::MFIter mfi(dof_field(lev), mfi_info); mfi.isValid();
              ++mfi) {
             const auto& bx = mfi.tilebox();
-            amrex::FArrayBox tmpfab(amrex::grow(bx, 1), 2);
-            tmpfab.setVal<amrex::RunOn::Device>(0.0);
 
             // Compression term coefficient
             if (iorder == 0) {
@@ -47,6 +46,25 @@ void multiphase::split_advection_step(
                     bx, dof_field(lev).array(mfi), fluxC(lev).array(mfi));
             }
 
+            // Tiles where the interface (and the band of cells that
+            // contribute to the fluxes) is absent only contain pure-phase
+            // cells, and the fluxes do not require a PLIC reconstruction
+            if (banded && !multiphase::has_interface(
+                              amrex::grow(bx, 1),
+                              dof_field(lev).const_array(mfi))) {
+                multiphase::split_compute_pure_fluxes(
+                    lev, bx, isweep + iorder, dof_field(lev).const_array(mfi),
+                    u_mac(lev).const_array(mfi), v_mac(lev).const_array(mfi),
+                    w_mac(lev).const_array(mfi), (*advas[lev][0]).array(mfi),
+                    (*advas[lev][1]).array(mfi), (*advas[lev][2]).array(mfi),
+                    (*fluxes[lev][0]).array(mfi), (*fluxes[lev][1]).array(mfi),
+                    (*fluxes[lev][2]).array(mfi), BCs, geom, dt);
+                continue;
+            }
+
+            amrex::FArrayBox tmpfab(amrex::grow(bx, 1), 2);
+            tmpfab.setVal<amrex::RunOn::Device>(0.0);
+
             // Calculate fluxes involved in this stage of split advection
             multiphase::split_compute_fluxes(
                 lev, bx, isweep + iorder, dof_field(lev).const_array(mfi),
@@ -169,6 +187,73 @@ void multiphase::split_compute_fluxes(
     }
 }
 
+void multiphase::split_compute_pure_fluxes(
+    const int lev,
+    amrex::Box const& bx,
+    const int isweep,
+    amrex::Array4<amrex::Real const> const& volfrac,
+    amrex::Array4<amrex::Real const> const& umac,
+    amrex::Array4<amrex::Real const> const& vmac,
+    amrex::Array4<amrex::Real const> const& wmac,
+    amrex::Array4<amrex::Real> const& aax,
+    amrex::Array4<amrex::Real> const& aay,
+    amrex::Array4<amrex::Real> const& aaz,
+    amrex::Array4<amrex::Real> const& fx,
+    amrex::Array4<amrex::Real> const& fy,
+    amrex::Array4<amrex::Real> const& fz,
+    amrex::GpuArray<BC, AMREX_SPACEDIM * 2> BCs,
+    amrex::Vector<amrex::Geometry> geom,
+    const amrex::Real dt)
+{
+    BL_PROFILE("amr-wind::multiphase::split_compute_pure_fluxes");
+
+    Box const& domain = geom[lev].Domain();
+    const auto domlo = amrex::lbound(domain);
+    const auto domhi = amrex::ubound(domain);
+
+    if (isweep % 3 == 0) {
+        Box const& zbx = amrex::surroundingNodes(bx, 2);
+        amrex::ParallelFor(
+            zbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                pure_fluxes_bc_save(
+                    i, j, k, 2, dt * wmac(i, j, k), volfrac, fz, aaz, BCs,
+                    domlo.z, domhi.z);
+            });
+    } else if (isweep % 3 == 1) {
+        Box const& ybx = amrex::surroundingNodes(bx, 1);
+        amrex::ParallelFor(
+            ybx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                pure_fluxes_bc_save(
+                    i, j, k, 1, dt * vmac(i, j, k), volfrac, fy, aay, BCs,
+                    domlo.y, domhi.y);
+            });
+    } else {
+        Box const& xbx = amrex::surroundingNodes(bx, 0);
+        amrex::ParallelFor(
+            xbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                pure_fluxes_bc_save(
+                    i, j, k, 0, dt * umac(i, j, k), volfrac, fx, aax, BCs,
+                    domlo.x, domhi.x);
+            });
+    }
+}
+
+bool multiphase::has_interface(
+    amrex::Box const& bx, amrex::Array4<amrex::Real const> const& volfrac)
+{
+    BL_PROFILE("amr-wind::multiphase::has_interface");
+
+    amrex::ReduceOps<amrex::ReduceOpSum> reduce_op;
+    amrex::ReduceData<int> reduce_data(reduce_op);
+    using ReduceTuple = typename decltype(reduce_data)::Type;
+    reduce_op.eval(
+        bx, reduce_data,
+        [=] AMREX_GPU_HOST_DEVICE(int i, int j, int k) -> ReduceTuple {
+            return {multiphase::is_pure_phase(volfrac(i, j, k)) ? 0 : 1};
+        });
+    return amrex::get<0>(reduce_data.value()) > 0;
+}
+
 void multiphase::split_compute_sum(
     const int lev,
     amrex::Box const& bx,
@@ -12,6 +12,7 @@ IB::IB(CFDSim& sim)
     : m_sim(sim)
     , m_ib_levelset(sim.repo().declare_field("ib_levelset", 1, 1, 1))
     , m_ib_normal(sim.repo().declare_field("ib_normal", AMREX_SPACEDIM, 1, 1))
+    , m_cell_list(sim)
 {
     m_ib_levelset.set_default_fillpatch_bc(sim.time());
     m_ib_normal.set_default_fillpatch_bc(sim.time());
@@ -27,6 +28,10 @@ void IB::pre_init_actions()
     amrex::Vector<std::string> labels;
     pp.getarr("labels", labels);
 
+    int verbose = 0;
+    pp.query("verbose", verbose);
+    m_cell_list.set_verbose(verbose);
+
     const int n_ibs = static_cast<int>(labels.size());
 
     for (int i = 0; i < n_ibs; ++i) {
@@ -57,9 +62,10 @@ void IB::post_init_actions()
     for (auto& ib : m_ibs) {
         ib->init_ib();
     }
+    m_cell_list.invalidate();
 }
 
-void IB::post_regrid_actions() {}
+void IB::post_regrid_actions() { m_cell_list.invalidate(); }
 
 void IB::pre_advance_work()
 {
@@ -0,0 +1,130 @@
+#include "amr-wind/immersed_boundary/IBCellList.H"
+#include "amr-wind/CFDSim.H"
+#include "amr-wind/fvm/gradient.H"
+#include "amr-wind/core/field_ops.H"
+
+#include "AMReX_Scan.H"
+
+namespace amr_wind::ib {
+
+namespace {
+
+/** Gather the indices of all cells in a box that satisfy a predicate
+ *
+ *  Uses a prefix sum over the cell flags so that the cells are stored in the
+ *  same (Fortran) order as they appear in the box.
+ */
+template <typename Predicate>
+void compact_cells(
+    const amrex::Box& bx, const Predicate& pred, IBCellList::CellList& cells)
+{
+    const auto lo = amrex::lbound(bx);
+    const auto len = amrex::length(bx);
+    const int ncells = static_cast<int>(bx.numPts());
+
+    amrex::Gpu::DeviceVector<int> flags(ncells + 1, 0);
+    amrex::Gpu::DeviceVector<int> offsets(ncells + 1);
+    int* flg = flags.data();
+    int* off = offsets.data();
+
+    amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+        const int idx = (i - lo.x) + len.x * ((j - lo.y) + len.y * (k - lo.z));
+        flg[idx] = pred(i, j, k) ? 1 : 0;
+    });
+
+    const int ntotal = amrex::Scan::ExclusiveSum(
+        ncells + 1, flg, off, amrex::Scan::retSum);
+
+    cells.resize(ntotal);
+    auto* cptr = cells.data();
+    amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+        const int idx = (i - lo.x) + len.x * ((j - lo.y) + len.y * (k - lo.z));
+        if (flg[idx] != 0) {
+            cptr[off[idx]] = amrex::IntVect(AMREX_D_DECL(i, j, k));
+        }
+    });
+    amrex::Gpu::streamSynchronize();
+}
+
+} // namespace
+
+IBCellList::IBCellList(CFDSim& sim) : m_sim(sim) {}
+
+void IBCellList::build()
+{
+    BL_PROFILE("amr-wind::ib::IBCellList::build");
+
+    const int nlevels = m_sim.repo().num_active_levels();
+    const auto& geom = m_sim.mesh().Geom();
+    auto& levelset = m_sim.repo().get_field("ib_levelset");
+    auto& normal = m_sim.repo().get_field("ib_normal");
+
+    levelset.fillpatch(m_sim.time().current_time());
+    fvm::gradient(normal, levelset);
+    field_ops::normalize(normal);
+    normal.fillpatch(m_sim.time().current_time());
+
+    m_cells.clear();
+    m_cells.resize(nlevels);
+    m_num_solid = 0;
+    m_num_forcing = 0;
+
+    for (int lev = 0; lev < nlevels; ++lev) {
+        const auto& dx = geom[lev].CellSizeArray();
+        // Defining the "ghost-cell" band distance
+        const amrex::Real phi_b = std::cbrt(dx[0] * dx[1] * dx[2]);
+
+        m_cells[lev].resize(levelset(lev).local_size());
+
+        for (amrex::MFIter mfi(levelset(lev)); mfi.isValid(); ++mfi) {
+            const auto& bx = mfi.tilebox();
+            const auto& gbx = mfi.growntilebox();
+            const auto phi = levelset(lev).const_array(mfi);
+            const auto norm_arr = normal(lev).array(mfi);
+            auto& bcells = m_cells[lev][mfi.LocalIndex()];
+
+            compact_cells(
+                bx,
+                [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                    return phi(i, j, k) < -phi_b;
+                },
+                bcells.solid);
+            compact_cells(
+                bx,
+                [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                    return (phi(i, j, k) < 0) && (phi(i, j, k) >= -phi_b);
+                },
+                bcells.forcing);
+            compact_cells(
+                gbx,
+                [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                    return phi(i, j, k) <= 0;
+                },
+                bcells.interior);
+
+            m_num_solid += bcells.solid.size();
+            m_num_forcing += bcells.forcing.size();
+
+            // Normals are only required within the forcing band
+            amrex::ParallelFor(
+                bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                    if ((phi(i, j, k) >= 0) || (phi(i, j, k) < -phi_b)) {
+                        norm_arr(i, j, k, 0) = 0.;
+                        norm_arr(i, j, k, 1) = 0.;
+                        norm_arr(i, j, k, 2) = 0.;
+                    }
+                });
+        }
+    }
+
+    amrex::ParallelDescriptor::ReduceLongSum(m_num_solid);
+    amrex::ParallelDescriptor::ReduceLongSum(m_num_forcing);
+    if (m_verbose > 0) {
+        amrex::Print() << "IB: active cells: " << m_num_solid << " solid, "
+                       << m_num_forcing << " forcing" << std::endl;
+    }
+
+    m_valid = true;
+}
+
+} // namespace amr_wind::ib
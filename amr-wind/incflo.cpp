@@ -7,6 +7,8 @@
 #include "amr-wind/equation_systems/SchemeTraits.H"
 #include "amr-wind/utilities/IOManager.H"
 #include "amr-wind/utilities/PostProcessing.H"
+#include "amr-wind/utilities/PerfMonitor.H"
+#include "amr-wind/utilities/BuddyCheckpoint.H"
 #include "amr-wind/overset/OversetManager.H"
 
 #include "AMReX_ParmParse.H"
@@ -110,6 +112,7 @@ void incflo::init_amr_wind_modules()
 
     m_sim.pde_manager().fillpatch_state_fields(m_time.current_time());
     m_sim.post_manager().post_init_actions();
+    m_sim.perf_monitor().initialize();
 }
 
 /** Initialize flow-field before performing time-integration.
@@ -158,6 +161,10 @@ void incflo::InitData()
     init_mesh();
     init_amr_wind_modules();
     prepare_for_time_integration();
+
+    if (m_field_memory_report) {
+        m_repo.print_memory_report();
+    }
 }
 
 /** Perform regrid actions at a given timestep.
@@ -212,6 +219,10 @@ bool incflo::regrid_and_update()
             pp->post_regrid_actions();
         }
         m_sim.post_manager().post_regrid_actions();
+
+        if (m_field_memory_report) {
+            m_repo.print_memory_report();
+        }
     }
 
     // update cell counts if unitialized or if a regrid happened
@@ -244,13 +255,26 @@ void incflo::post_advance_work()
         PrintMaxValues("end of timestep");
     }
 
-    if (m_time.write_plot_file()) {
-        m_sim.io_manager().write_plot_file();
-    }
+    m_time.update_output_triggers();
+    {
+        amr_wind::PerfMonitor::ScopedPhase phase(
+            m_sim.perf_monitor(), amr_wind::PerfMonitor::Phase::Output);
+        if (m_time.write_plot_file()) {
+            m_sim.io_manager().write_plot_file();
+        }
 
-    if (m_time.write_checkpoint()) {
-        m_sim.io_manager().write_checkpoint_file();
+        if (m_time.write_checkpoint()) {
+            m_sim.io_manager().write_checkpoint_file();
+        }
+
+        auto& buddy_chk = m_sim.io_manager().buddy_checkpoint();
+        if (buddy_chk.is_snapshot_step()) {
+            buddy_chk.save();
+        }
     }
+
+    // Roll back to the last in-memory checkpoint if a failure is simulated
+    m_sim.io_manager().buddy_checkpoint().test_failure();
 }
 
 /** Perform time-integration for user-defined time or timesteps.
@@ -261,11 +285,17 @@ void incflo::Evolve()
 {
     BL_PROFILE("amr-wind::incflo::Evolve()");
 
+    using PerfPhase = amr_wind::PerfMonitor::Phase;
+    auto& perf = m_sim.perf_monitor();
     while (m_time.new_timestep()) {
+        perf.begin_step();
         amrex::Real time0 = amrex::ParallelDescriptor::second();
 
+        perf.start(PerfPhase::Regrid);
         regrid_and_update();
+        perf.stop(PerfPhase::Regrid);
 
+        perf.start(PerfPhase::PreAdvance);
         if (m_prescribe_vel) {
             pre_advance_stage2();
             ComputePrescribeDt();
@@ -273,18 +303,24 @@ void incflo::Evolve()
             pre_advance_stage1();
             pre_advance_stage2();
         }
+        perf.stop(PerfPhase::PreAdvance);
 
         amrex::Real time1 = amrex::ParallelDescriptor::second();
         // Advance to time t + dt
+        perf.start(PerfPhase::Advance);
         if (m_prescribe_vel) {
             prescribe_advance();
         } else {
             advance();
         }
+        perf.stop(PerfPhase::Advance);
         amrex::Print() << std::endl;
         amrex::Real time2 = amrex::ParallelDescriptor::second();
+        perf.start(PerfPhase::PostAdvance);
         post_advance_work();
+        perf.stop(PerfPhase::PostAdvance);
         amrex::Real time3 = amrex::ParallelDescriptor::second();
+        perf.end_step();
 
         amrex::Print() << "WallClockTime: " << m_time.time_index()
                        << " Pre: " << std::setprecision(3) << (time1 - time0)
@@ -310,6 +346,8 @@ void incflo::Evolve()
     if (m_time.write_last_checkpoint()) {
         m_sim.io_manager().write_checkpoint_file();
     }
+    m_sim.post_manager().wait_for_tasks();
+    perf.flush();
 }
 
 // Make a new level from scratch using provided BoxArray and
@@ -1,6 +1,7 @@
 #include <cmath>
 
 #include "amr-wind/mesh_mapping_models/ChannelFlowMap.H"
+#include "amr-wind/core/mfiter_loops.H"
 
 #include "AMReX_ParmParse.H"
 
@@ -49,6 +50,7 @@ ChannelFlowMap::ChannelFlowMap()
  */
 void ChannelFlowMap::create_map(int lev, const amrex::Geometry& geom)
 {
+    BL_PROFILE("amr-wind::ChannelFlowMap::create_map");
     create_cell_node_map(lev, geom);
     create_face_map(lev, geom);
     create_non_uniform_mesh(lev, geom);
@@ -70,7 +72,7 @@ void ChannelFlowMap::create_cell_node_map(int lev, const amrex::Geometry& geom)
         {prob_hi[0] - prob_lo[0], prob_hi[1] - prob_lo[1],
          prob_hi[2] - prob_lo[2]}};
 
-    for (amrex::MFIter mfi((*m_mesh_scale_fac_cc)(lev)); mfi.isValid(); ++mfi) {
+    for_each_tile((*m_mesh_scale_fac_cc)(lev), [&](const amrex::MFIter& mfi) {
 
         const auto& bx = mfi.growntilebox();
         amrex::Array4<amrex::Real> const& scale_fac_cc =
@@ -128,7 +130,7 @@ void ChannelFlowMap::create_cell_node_map(int lev, const amrex::Geometry& geom)
                                          scale_fac_nd(i, j, k, 1) *
                                          scale_fac_nd(i, j, k, 2);
             });
-    }
+    });
 
     // TODO: Call fill patch operators ?
 }
@@ -149,7 +151,7 @@ void ChannelFlowMap::create_face_map(int lev, const amrex::Geometry& geom)
         {prob_hi[0] - prob_lo[0], prob_hi[1] - prob_lo[1],
          prob_hi[2] - prob_lo[2]}};
 
-    for (amrex::MFIter mfi((*m_mesh_scale_fac_xf)(lev)); mfi.isValid(); ++mfi) {
+    for_each_tile((*m_mesh_scale_fac_xf)(lev), [&](const amrex::MFIter& mfi) {
 
         const auto& bx = mfi.growntilebox();
         amrex::Array4<amrex::Real> const& scale_fac_xf =
@@ -179,9 +181,9 @@ void ChannelFlowMap::create_face_map(int lev, const amrex::Geometry& geom)
                                          scale_fac_xf(i, j, k, 1) *
                                          scale_fac_xf(i, j, k, 2);
             });
-    }
+    });
 
-    for (amrex::MFIter mfi((*m_mesh_scale_fac_yf)(lev)); mfi.isValid(); ++mfi) {
+    for_each_tile((*m_mesh_scale_fac_yf)(lev), [&](const amrex::MFIter& mfi) {
 
         const auto& bx = mfi.growntilebox();
         amrex::Array4<amrex::Real> const& scale_fac_yf =
@@ -211,9 +213,9 @@ void ChannelFlowMap::create_face_map(int lev, const amrex::Geometry& geom)
                                          scale_fac_yf(i, j, k, 1) *
                                          scale_fac_yf(i, j, k, 2);
             });
-    }
+    });
 
-    for (amrex::MFIter mfi((*m_mesh_scale_fac_zf)(lev)); mfi.isValid(); ++mfi) {
+    for_each_tile((*m_mesh_scale_fac_zf)(lev), [&](const amrex::MFIter& mfi) {
 
         const auto& bx = mfi.growntilebox();
         amrex::Array4<amrex::Real> const& scale_fac_zf =
@@ -243,7 +245,7 @@ void ChannelFlowMap::create_face_map(int lev, const amrex::Geometry& geom)
                                          scale_fac_zf(i, j, k, 1) *
                                          scale_fac_zf(i, j, k, 2);
             });
-    }
+    });
 
     // TODO: Call fill patch operators ?
 }
@@ -277,60 +279,61 @@ void ChannelFlowMap::create_non_uniform_mesh(
         {probhi_physical[0] - prob_lo[0], probhi_physical[1] - prob_lo[1],
          probhi_physical[2] - prob_lo[2]}};
 
-    for (amrex::MFIter mfi((*m_non_uniform_coord_cc)(lev)); mfi.isValid();
-         ++mfi) {
-
-        const auto& bx = mfi.growntilebox();
-        amrex::Array4<amrex::Real> const& nu_coord_cc =
-            (*m_non_uniform_coord_cc)(lev).array(mfi);
-        amrex::ParallelFor(
-            bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-                amrex::Real x = prob_lo[0] + (i + 0.5) * dx[0];
-                amrex::Real y = prob_lo[1] + (j + 0.5) * dx[1];
-                amrex::Real z = prob_lo[2] + (k + 0.5) * dx[2];
-
-                amrex::Real x_non_uni =
-                    eval_coord(x, beta[0], prob_lo[0], len[0]);
-                amrex::Real y_non_uni =
-                    eval_coord(y, beta[1], prob_lo[1], len[1]);
-                amrex::Real z_non_uni =
-                    eval_coord(z, beta[2], prob_lo[2], len[2]);
-
-                bool in_domain =
-                    ((x > prob_lo[0]) && (x < prob_hi[0]) && (y > prob_lo[1]) &&
-                     (y < prob_hi[1]) && (z > prob_lo[2]) && (z < prob_hi[2]));
-
-                nu_coord_cc(i, j, k, 0) = in_domain ? x_non_uni : x;
-                nu_coord_cc(i, j, k, 1) = in_domain ? y_non_uni : y;
-                nu_coord_cc(i, j, k, 2) = in_domain ? z_non_uni : z;
-            });
-
-        const auto& nbx = mfi.grownnodaltilebox();
-        amrex::Array4<amrex::Real> const& nu_coord_nd =
-            (*m_non_uniform_coord_nd)(lev).array(mfi);
-        amrex::ParallelFor(
-            nbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-                amrex::Real x = prob_lo[0] + i * dx[0];
-                amrex::Real y = prob_lo[1] + j * dx[1];
-                amrex::Real z = prob_lo[2] + k * dx[2];
-
-                amrex::Real x_non_uni =
-                    eval_coord(x, beta[0], prob_lo[0], len[0]);
-                amrex::Real y_non_uni =
-                    eval_coord(y, beta[1], prob_lo[1], len[1]);
-                amrex::Real z_non_uni =
-                    eval_coord(z, beta[2], prob_lo[2], len[2]);
-
-                bool in_domain =
-                    ((x >= prob_lo[0] - eps) && (x <= prob_hi[0] + eps) &&
-                     (y >= prob_lo[1] - eps) && (y <= prob_hi[1] + eps) &&
-                     (z >= prob_lo[2] - eps) && (z <= prob_hi[2] + eps));
-
-                nu_coord_nd(i, j, k, 0) = in_domain ? x_non_uni : x;
-                nu_coord_nd(i, j, k, 1) = in_domain ? y_non_uni : y;
-                nu_coord_nd(i, j, k, 2) = in_domain ? z_non_uni : z;
-            });
-    }
+    for_each_tile(
+        (*m_non_uniform_coord_cc)(lev), [&](const amrex::MFIter& mfi) {
+
+            const auto& bx = mfi.growntilebox();
+            amrex::Array4<amrex::Real> const& nu_coord_cc =
+                (*m_non_uniform_coord_cc)(lev).array(mfi);
+            amrex::ParallelFor(
+                bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                    amrex::Real x = prob_lo[0] + (i + 0.5) * dx[0];
+                    amrex::Real y = prob_lo[1] + (j + 0.5) * dx[1];
+                    amrex::Real z = prob_lo[2] + (k + 0.5) * dx[2];
+
+                    amrex::Real x_non_uni =
+                        eval_coord(x, beta[0], prob_lo[0], len[0]);
+                    amrex::Real y_non_uni =
+                        eval_coord(y, beta[1], prob_lo[1], len[1]);
+                    amrex::Real z_non_uni =
+                        eval_coord(z, beta[2], prob_lo[2], len[2]);
+
+                    bool in_domain =
+                        ((x > prob_lo[0]) && (x < prob_hi[0]) &&
+                         (y > prob_lo[1]) && (y < prob_hi[1]) &&
+                         (z > prob_lo[2]) && (z < prob_hi[2]));
+
+                    nu_coord_cc(i, j, k, 0) = in_domain ? x_non_uni : x;
+                    nu_coord_cc(i, j, k, 1) = in_domain ? y_non_uni : y;
+                    nu_coord_cc(i, j, k, 2) = in_domain ? z_non_uni : z;
+                });
+
+            const auto& nbx = mfi.grownnodaltilebox();
+            amrex::Array4<amrex::Real> const& nu_coord_nd =
+                (*m_non_uniform_coord_nd)(lev).array(mfi);
+            amrex::ParallelFor(
+                nbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                    amrex::Real x = prob_lo[0] + i * dx[0];
+                    amrex::Real y = prob_lo[1] + j * dx[1];
+                    amrex::Real z = prob_lo[2] + k * dx[2];
+
+                    amrex::Real x_non_uni =
+                        eval_coord(x, beta[0], prob_lo[0], len[0]);
+                    amrex::Real y_non_uni =
+                        eval_coord(y, beta[1], prob_lo[1], len[1]);
+                    amrex::Real z_non_uni =
+                        eval_coord(z, beta[2], prob_lo[2], len[2]);
+
+                    bool in_domain =
+                        ((x >= prob_lo[0] - eps) && (x <= prob_hi[0] + eps) &&
+                         (y >= prob_lo[1] - eps) && (y <= prob_hi[1] + eps) &&
+                         (z >= prob_lo[2] - eps) && (z <= prob_hi[2] + eps));
+
+                    nu_coord_nd(i, j, k, 0) = in_domain ? x_non_uni : x;
+                    nu_coord_nd(i, j, k, 1) = in_domain ? y_non_uni : y;
+                    nu_coord_nd(i, j, k, 2) = in_domain ? z_non_uni : z;
+                });
+        });
 }
 
 } // namespace amr_wind::channel_map
@@ -1,4 +1,5 @@
 #include "amr-wind/mesh_mapping_models/ConstantMap.H"
+#include "amr-wind/core/mfiter_loops.H"
 
 #include "AMReX_ParmParse.H"
 
@@ -14,6 +15,7 @@ ConstantMap::ConstantMap()
  */
 void ConstantMap::create_map(int lev, const amrex::Geometry& geom)
 {
+    BL_PROFILE("amr-wind::ConstantMap::create_map");
     create_cell_node_map(lev);
     create_face_map(lev);
     create_non_uniform_mesh(lev, geom);
@@ -27,7 +29,7 @@ void ConstantMap::create_cell_node_map(int lev)
     amrex::Real fac_y = m_fac[1];
     amrex::Real fac_z = m_fac[2];
 
-    for (amrex::MFIter mfi((*m_mesh_scale_fac_cc)(lev)); mfi.isValid(); ++mfi) {
+    for_each_tile((*m_mesh_scale_fac_cc)(lev), [&](const amrex::MFIter& mfi) {
 
         const auto& bx = mfi.growntilebox();
         amrex::Array4<amrex::Real> const& scale_fac_cc =
@@ -58,7 +60,7 @@ void ConstantMap::create_cell_node_map(int lev)
                                          scale_fac_nd(i, j, k, 1) *
                                          scale_fac_nd(i, j, k, 2);
             });
-    }
+    });
 }
 
 /** Construct the mesh mapping field on cell faces
@@ -69,7 +71,7 @@ void ConstantMap::create_face_map(int lev)
     amrex::Real fac_y = m_fac[1];
     amrex::Real fac_z = m_fac[2];
 
-    for (amrex::MFIter mfi((*m_mesh_scale_fac_xf)(lev)); mfi.isValid(); ++mfi) {
+    for_each_tile((*m_mesh_scale_fac_xf)(lev), [&](const amrex::MFIter& mfi) {
         const auto& bx = mfi.growntilebox();
         amrex::Array4<amrex::Real> const& scale_fac_xf =
             (*m_mesh_scale_fac_xf)(lev).array(mfi);
@@ -84,9 +86,9 @@ void ConstantMap::create_face_map(int lev)
                                          scale_fac_xf(i, j, k, 1) *
                                          scale_fac_xf(i, j, k, 2);
             });
-    }
+    });
 
-    for (amrex::MFIter mfi((*m_mesh_scale_fac_yf)(lev)); mfi.isValid(); ++mfi) {
+    for_each_tile((*m_mesh_scale_fac_yf)(lev), [&](const amrex::MFIter& mfi) {
         const auto& bx = mfi.growntilebox();
         amrex::Array4<amrex::Real> const& scale_fac_yf =
             (*m_mesh_scale_fac_yf)(lev).array(mfi);
@@ -101,9 +103,9 @@ void ConstantMap::create_face_map(int lev)
                                          scale_fac_yf(i, j, k, 1) *
                                          scale_fac_yf(i, j, k, 2);
             });
-    }
+    });
 
-    for (amrex::MFIter mfi((*m_mesh_scale_fac_zf)(lev)); mfi.isValid(); ++mfi) {
+    for_each_tile((*m_mesh_scale_fac_zf)(lev), [&](const amrex::MFIter& mfi) {
         const auto& bx = mfi.growntilebox();
         amrex::Array4<amrex::Real> const& scale_fac_zf =
             (*m_mesh_scale_fac_zf)(lev).array(mfi);
@@ -118,7 +120,7 @@ void ConstantMap::create_face_map(int lev)
                                          scale_fac_zf(i, j, k, 1) *
                                          scale_fac_zf(i, j, k, 2);
             });
-    }
+    });
 }
 
 /** Construct the non-uniform mesh field
@@ -129,39 +131,42 @@ void ConstantMap::create_non_uniform_mesh(int lev, const amrex::Geometry& geom)
     const auto& problo = geom.ProbLoArray();
     const auto& dx = geom.CellSizeArray();
 
-    for (amrex::MFIter mfi((*m_non_uniform_coord_cc)(lev)); mfi.isValid();
-         ++mfi) {
-
-        const auto& bx = mfi.growntilebox();
-        amrex::Array4<amrex::Real> const& scale_fac_cc =
-            (*m_mesh_scale_fac_cc)(lev).array(mfi);
-        amrex::Array4<amrex::Real> const& nu_coord_cc =
-            (*m_non_uniform_coord_cc)(lev).array(mfi);
-        amrex::ParallelFor(
-            bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-                nu_coord_cc(i, j, k, 0) =
-                    problo[0] + (i + 0.5) * dx[0] * scale_fac_cc(i, j, k, 0);
-                nu_coord_cc(i, j, k, 1) =
-                    problo[1] + (j + 0.5) * dx[1] * scale_fac_cc(i, j, k, 1);
-                nu_coord_cc(i, j, k, 2) =
-                    problo[2] + (k + 0.5) * dx[2] * scale_fac_cc(i, j, k, 2);
-            });
-
-        const auto& nbx = mfi.grownnodaltilebox();
-        amrex::Array4<amrex::Real> const& scale_fac_nd =
-            (*m_mesh_scale_fac_nd)(lev).array(mfi);
-        amrex::Array4<amrex::Real> const& nu_coord_nd =
-            (*m_non_uniform_coord_nd)(lev).array(mfi);
-        amrex::ParallelFor(
-            nbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-                nu_coord_nd(i, j, k, 0) =
-                    problo[0] + i * dx[0] * scale_fac_nd(i, j, k, 0);
-                nu_coord_nd(i, j, k, 1) =
-                    problo[1] + j * dx[1] * scale_fac_nd(i, j, k, 1);
-                nu_coord_nd(i, j, k, 2) =
-                    problo[2] + k * dx[2] * scale_fac_nd(i, j, k, 2);
-            });
-    }
+    for_each_tile(
+        (*m_non_uniform_coord_cc)(lev), [&](const amrex::MFIter& mfi) {
+
+            const auto& bx = mfi.growntilebox();
+            amrex::Array4<amrex::Real> const& scale_fac_cc =
+                (*m_mesh_scale_fac_cc)(lev).array(mfi);
+            amrex::Array4<amrex::Real> const& nu_coord_cc =
+                (*m_non_uniform_coord_cc)(lev).array(mfi);
+            amrex::ParallelFor(
+                bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                    nu_coord_cc(i, j, k, 0) =
+                        problo[0] +
+                        (i + 0.5) * dx[0] * scale_fac_cc(i, j, k, 0);
+                    nu_coord_cc(i, j, k, 1) =
+                        problo[1] +
+                        (j + 0.5) * dx[1] * scale_fac_cc(i, j, k, 1);
+                    nu_coord_cc(i, j, k, 2) =
+                        problo[2] +
+                        (k + 0.5) * dx[2] * scale_fac_cc(i, j, k, 2);
+                });
+
+            const auto& nbx = mfi.grownnodaltilebox();
+            amrex::Array4<amrex::Real> const& scale_fac_nd =
+                (*m_mesh_scale_fac_nd)(lev).array(mfi);
+            amrex::Array4<amrex::Real> const& nu_coord_nd =
+                (*m_non_uniform_coord_nd)(lev).array(mfi);
+            amrex::ParallelFor(
+                nbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                    nu_coord_nd(i, j, k, 0) =
+                        problo[0] + i * dx[0] * scale_fac_nd(i, j, k, 0);
+                    nu_coord_nd(i, j, k, 1) =
+                        problo[1] + j * dx[1] * scale_fac_nd(i, j, k, 1);
+                    nu_coord_nd(i, j, k, 2) =
+                        problo[2] + k * dx[2] * scale_fac_nd(i, j, k, 2);
+                });
+        });
 }
 
 } // namespace amr_wind::const_map
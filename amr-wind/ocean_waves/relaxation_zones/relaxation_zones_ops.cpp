@@ -1,4 +1,5 @@
 #include "amr-wind/ocean_waves/relaxation_zones/relaxation_zones_ops.H"
+#include "amr-wind/ocean_waves/relaxation_zones/wave_tables.H"
 #include "amr-wind/physics/multiphase/MultiPhase.H"
 #include "amr-wind/equation_systems/vof/volume_fractions.H"
 #include "amr-wind/core/MultiParser.H"
@@ -7,6 +8,7 @@
 
 #include "amr-wind/fvm/gradient.H"
 #include "amr-wind/core/field_ops.H"
+#include "amr-wind/core/mfiter_loops.H"
 
 #include "amr-wind/ocean_waves/utils/wave_utils_K.H"
 
@@ -61,7 +63,7 @@ void apply_relaxation_zones(CFDSim& sim, const RelaxZonesBaseData& wdata)
         auto& target_vof = m_ow_vof(lev);
         const auto& dx = geom[lev].CellSizeArray();
 
-        for (amrex::MFIter mfi(ls); mfi.isValid(); ++mfi) {
+        for_each_tile(ls, [&](const amrex::MFIter& mfi) {
             const auto& gbx = mfi.growntilebox(2);
             const amrex::Array4<amrex::Real>& phi = ls.array(mfi);
             const amrex::Array4<amrex::Real>& volfrac = target_vof.array(mfi);
@@ -71,7 +73,7 @@ void apply_relaxation_zones(CFDSim& sim, const RelaxZonesBaseData& wdata)
                     volfrac(i, j, k) =
                         multiphase::levelset_to_vof(i, j, k, eps, phi);
                 });
-        }
+        });
     }
 
     // Get time
@@ -83,24 +85,39 @@ void apply_relaxation_zones(CFDSim& sim, const RelaxZonesBaseData& wdata)
     auto& velocity = sim.repo().get_field("velocity");
     auto& density = sim.repo().get_field("density");
 
+    const amrex::Real gen_length = wdata.gen_length;
+    const amrex::Real beach_length = wdata.beach_length;
+    const amrex::Real zsl = wdata.zsl;
+    const bool has_beach = wdata.has_beach;
+    const bool has_outprofile = wdata.has_outprofile;
+
     for (int lev = 0; lev < nlevels; ++lev) {
-        for (amrex::MFIter mfi(vof(lev)); mfi.isValid(); ++mfi) {
+        const auto& dx = geom[lev].CellSizeArray();
+        const auto& problo = geom[lev].ProbLoArray();
+        const auto& probhi = geom[lev].ProbHiArray();
+
+        // The blending weights only vary along x, evaluate them once per
+        // column instead of once per cell
+        WaveTable gtable(geom[lev], 0, 2, 2);
+        gtable.fill(
+            [=] AMREX_GPU_DEVICE(
+                const amrex::Real xc, amrex::Real* vals) noexcept {
+                const amrex::Real x =
+                    amrex::min(amrex::max(xc, problo[0]), probhi[0]);
+                vals[0] = utils::Gamma_generate(x - problo[0], gen_length);
+                vals[1] = utils::Gamma_absorb(
+                    x - (probhi[0] - beach_length), beach_length, 1.0);
+            });
+        const auto gamma = gtable.view();
+
+        for_each_tile(vof(lev), [&](const amrex::MFIter& mfi) {
             const auto& gbx = mfi.growntilebox(2);
-            const auto& dx = geom[lev].CellSizeArray();
-            const auto& problo = geom[lev].ProbLoArray();
-            const auto& probhi = geom[lev].ProbHiArray();
             auto vel = velocity(lev).array(mfi);
             auto rho = density(lev).array(mfi);
             auto volfrac = vof(lev).array(mfi);
             auto target_volfrac = m_ow_vof(lev).array(mfi);
             auto target_vel = m_ow_vel(lev).array(mfi);
 
-            const amrex::Real gen_length = wdata.gen_length;
-            const amrex::Real beach_length = wdata.beach_length;
-            const amrex::Real zsl = wdata.zsl;
-            const bool has_beach = wdata.has_beach;
-            const bool has_outprofile = wdata.has_outprofile;
-
             amrex::ParallelFor(
                 gbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
                     const amrex::Real x = amrex::min(
@@ -112,8 +129,7 @@ void apply_relaxation_zones(CFDSim& sim, const RelaxZonesBaseData& wdata)
 
                     // Generation region
                     if (x <= problo[0] + gen_length) {
-                        const amrex::Real Gamma =
-                            utils::Gamma_generate(x - problo[0], gen_length);
+                        const amrex::Real Gamma = gamma(i, 0);
                         const amrex::Real vf =
                             (1. - Gamma) * target_volfrac(i, j, k) * rampf +
                             Gamma * volfrac(i, j, k);
@@ -149,8 +165,7 @@ void apply_relaxation_zones(CFDSim& sim, const RelaxZonesBaseData& wdata)
                     }
                     // Numerical beach (sponge layer)
                     if (x + beach_length >= probhi[0]) {
-                        const amrex::Real Gamma = utils::Gamma_absorb(
-                            x - (probhi[0] - beach_length), beach_length, 1.0);
+                        const amrex::Real Gamma = gamma(i, 1);
                         if (has_beach) {
                             volfrac(i, j, k) =
                                 (1.0 - Gamma) *
@@ -204,7 +219,8 @@ void apply_relaxation_zones(CFDSim& sim, const RelaxZonesBaseData& wdata)
                     rho(i, j, k) = rho1 * volfrac(i, j, k) +
                                    rho2 * (1. - volfrac(i, j, k));
                 });
-        }
+        });
+        amrex::Gpu::streamSynchronize();
     }
     // This helps for having periodic boundaries, but will need to be addressed
     // for the general case
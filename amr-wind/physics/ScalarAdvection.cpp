@@ -255,18 +255,7 @@ ScalarAdvection::compute_error(const Shape& scalar_function)
 
     for (int level = 0; level < nlevels; ++level) {
         amrex::Real err_lev = 0.0;
-        amrex::iMultiFab level_mask;
-        if (level < nlevels - 1) {
-            level_mask = makeFineMask(
-                m_repo.mesh().boxArray(level),
-                m_repo.mesh().DistributionMap(level),
-                m_repo.mesh().boxArray(level + 1), amrex::IntVect(2), 1, 0);
-        } else {
-            level_mask.define(
-                m_repo.mesh().boxArray(level),
-                m_repo.mesh().DistributionMap(level), 1, 0, amrex::MFInfo());
-            level_mask.setVal(1);
-        }
+        const auto& level_mask = m_repo.fine_masks().cell_mask(level);
 
         const auto& dx = m_repo.mesh().Geom(level).CellSizeArray();
         const auto& problo = m_repo.mesh().Geom(level).ProbLoArray();
@@ -276,7 +265,7 @@ ScalarAdvection::compute_error(const Shape& scalar_function)
         for (amrex::MFIter mfi(scalar); mfi.isValid(); ++mfi) {
             const auto& vbx = mfi.validbox();
             const auto& scalar_arr = scalar.array(mfi);
-            const auto& mask_arr = level_mask.array(mfi);
+            const auto& mask_arr = level_mask.const_array(mfi);
 
             amrex::Real err_fab = 0.0;
             amrex::LoopOnCpu(vbx, [=, &err_fab](int i, int j, int k) noexcept {
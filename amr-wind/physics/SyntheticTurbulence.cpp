@@ -1,4 +1,6 @@
 #include <memory>
+#include <future>
+#include <utility>
 
 #include "amr-wind/physics/SyntheticTurbulence.H"
 #include "amr-wind/CFDSim.H"
@@ -9,6 +11,7 @@
 #include "AMReX_iMultiFab.H"
 #include "AMReX_MultiFabUtil.H"
 #include "AMReX_ParmParse.H"
+#include "AMReX_ParallelDescriptor.H"
 
 namespace amr_wind {
 namespace synth_turb {
@@ -97,11 +100,82 @@ private:
 
 namespace {
 
+#ifdef AMR_WIND_USE_NETCDF
+/** Read consecutive planes of perturbation velocities from the turbulence file
+ *
+ *  The u, v, w components are interleaved into the output array so that the
+ *  planes can be transferred to the device with a single copy.
+ *
+ *  @param ncf Turbulence database
+ *  @param box_dims Dimensions of the turbulence box
+ *  @param istart Index of the first plane to be read
+ *  @param nplanes Number of planes to be read
+ *  @param vel Output array of size (nplanes, ny, nz, 3)
+ */
+void read_turb_planes(
+    const ncutils::NCFile& ncf,
+    const vs::VectorT<int>& box_dims,
+    const int istart,
+    const int nplanes,
+    double* vel)
+{
+    // clang-format off
+    const std::vector<size_t> start{{static_cast<size_t>(istart), 0, 0}};
+    const std::vector<size_t> count{{static_cast<size_t>(nplanes),
+                                     static_cast<size_t>(box_dims[1]),
+                                     static_cast<size_t>(box_dims[2])}};
+    // clang-format on
+    const size_t npts = count[0] * count[1] * count[2];
+
+    std::vector<double> buf(npts);
+    const amrex::Vector<std::string> vnames{"uvel", "vvel", "wvel"};
+    for (int n = 0; n < AMREX_SPACEDIM; ++n) {
+        ncf.var(vnames[n]).get(buf.data(), start, count);
+        for (size_t i = 0; i < npts; ++i) {
+            vel[i * AMREX_SPACEDIM + n] = buf[i];
+        }
+    }
+}
+
+/** Read the two planes that bound the current timestep from the turbulence
+ *  file into an interleaved array
+ */
+void read_turb_plane_data(
+    const std::string& turb_filename,
+    const vs::VectorT<int>& box_dims,
+    const int il,
+    const int ir,
+    amrex::Vector<double>& vel)
+{
+    BL_PROFILE("amr-wind::SyntheticTurbulence::read_plane_data");
+    auto ncf = ncutils::NCFile::open(turb_filename, NC_NOWRITE);
+
+    if ((ir - il) == 1) {
+        // two consequtive planes load them in one shot
+        read_turb_planes(ncf, box_dims, il, 2, vel.data());
+    } else {
+        // Load the planes separately
+        const size_t offset = static_cast<size_t>(box_dims[1]) * box_dims[2] *
+                              AMREX_SPACEDIM;
+        read_turb_planes(ncf, box_dims, il, 1, vel.data());
+        read_turb_planes(ncf, box_dims, ir, 1, &vel[offset]);
+    }
+
+    ncf.close();
+}
+#endif
+
+} // namespace
+
+namespace synth_turb {
+
 /** Parse the NetCDF turbulence database and determine details of the turbulence
  *box.
  *
  *. Initializes the dimensions and grid length, sizes in SynthTurbData. Also
- *  allocates the necessary memory for the perturbation velocities.
+ *  allocates the necessary memory for the perturbation velocities. If the
+ *  entire box is to be kept in memory, the box is read by the I/O processor,
+ *  broadcast to all processes and copied to the device once.
  *
  *. @param turbFile Information regarding NetCDF data identifiers
  *. @param turbGrid Turbulence data
@@ -109,35 +183,66 @@ namespace {
 void process_nc_file(const std::string& turb_filename, SynthTurbData& turb_grid)
 {
 #ifdef AMR_WIND_USE_NETCDF
-    auto ncf = ncutils::NCFile::open(turb_filename, NC_NOWRITE);
-
-    // Grid dimensions
-    AMREX_ASSERT(ncf.dim("ndim").len() == AMREX_SPACEDIM);
-    auto nx = ncf.dim("nx").len();
-    auto ny = ncf.dim("ny").len();
-    auto nz = ncf.dim("nz").len();
-
-    turb_grid.box_dims[0] = nx;
-    turb_grid.box_dims[1] = ny;
-    turb_grid.box_dims[2] = nz;
-
-    // Box lengths and resolution
-    auto box_len = ncf.var("box_lengths");
-    box_len.get(turb_grid.box_len.data());
-    auto dx = ncf.var("dx");
-    dx.get(turb_grid.dx.data());
-
-    ncf.close();
+    const bool is_io = amrex::ParallelDescriptor::IOProcessor();
+    const int io_proc = amrex::ParallelDescriptor::IOProcessorNumber();
+
+    // Only the I/O processor reads the file, the metadata is broadcast
+    amrex::Vector<int> dims(AMREX_SPACEDIM + 1, 0);
+    amrex::Vector<double> lengths(2 * AMREX_SPACEDIM, 0.0);
+    if (is_io) {
+        auto ncf = ncutils::NCFile::open(turb_filename, NC_NOWRITE);
+
+        // Grid dimensions
+        dims[0] = static_cast<int>(ncf.dim("ndim").len());
+        dims[1] = static_cast<int>(ncf.dim("nx").len());
+        dims[2] = static_cast<int>(ncf.dim("ny").len());
+        dims[3] = static_cast<int>(ncf.dim("nz").len());
+
+        // Box lengths and resolution
+        ncf.var("box_lengths").get(&lengths[0]);
+        ncf.var("dx").get(&lengths[AMREX_SPACEDIM]);
+
+        ncf.close();
+    }
+    amrex::ParallelDescriptor::Bcast(dims.data(), dims.size(), io_proc);
+    amrex::ParallelDescriptor::Bcast(lengths.data(), lengths.size(), io_proc);
+
+    AMREX_ALWAYS_ASSERT(dims[0] == AMREX_SPACEDIM);
+    for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+        turb_grid.box_dims[i] = dims[i + 1];
+        turb_grid.box_len[i] = lengths[i];
+        turb_grid.dx[i] = lengths[i + AMREX_SPACEDIM];
+    }
+    const auto ny = static_cast<size_t>(turb_grid.box_dims[1]);
+    const auto nz = static_cast<size_t>(turb_grid.box_dims[2]);
 
     // Create data structures to store the perturbation velocities for two
-    // planes
-    const size_t grid_size = 2 * ny * nz;
-    turb_grid.uvel.resize(grid_size);
-    turb_grid.vvel.resize(grid_size);
-    turb_grid.wvel.resize(grid_size);
-    turb_grid.uvel_d.resize(grid_size);
-    turb_grid.vvel_d.resize(grid_size);
-    turb_grid.wvel_d.resize(grid_size);
+    // planes or the entire box
+    turb_grid.nplanes = turb_grid.box_resident ? turb_grid.box_dims[0] : 2;
+    const size_t grid_size = turb_grid.nplanes * ny * nz * AMREX_SPACEDIM;
+    turb_grid.vel.resize(grid_size);
+    turb_grid.vel_d.resize(grid_size);
+
+    if (turb_grid.box_resident) {
+        if (is_io) {
+            auto ncf = ncutils::NCFile::open(turb_filename, NC_NOWRITE);
+            read_turb_planes(
+                ncf, turb_grid.box_dims, 0, turb_grid.nplanes,
+                turb_grid.vel.data());
+            ncf.close();
+        }
+        amrex::ParallelDescriptor::Bcast(
+            turb_grid.vel.data(), turb_grid.vel.size(), io_proc);
+        amrex::Gpu::copy(
+            amrex::Gpu::hostToDevice, turb_grid.vel.begin(),
+            turb_grid.vel.end(), turb_grid.vel_d.begin());
+        amrex::Gpu::streamSynchronize();
+
+        // The host copy is no longer needed
+        amrex::Vector<double>().swap(turb_grid.vel);
+    } else if (turb_grid.prefetch_planes && is_io) {
+        turb_grid.prefetch_vel.resize(grid_size);
+    }
 #else
     amrex::ignore_unused(turb_filename, turb_grid);
 #endif
@@ -146,7 +251,16 @@ void process_nc_file(const std::string& turb_filename, SynthTurbData& turb_grid)
 /** Load two planes of data that bound the current timestep
  *
  *  The data for the y and z directions are loaded for the entire grid at the
- * two planes
+ *  two planes. The planes are read by the I/O processor and broadcast to all
+ *  the other processes. Nothing is read if the entire box is kept in memory.
+ *
+ *  If prefetching is enabled, the planes expected at the next refresh are read
+ *  in the background. The planes are expected to advance by the same number of
+ *  planes as in the last refresh. If a different pair of planes is requested,
+ *  the prefetched data is discarded and the planes are read directly. The
+ *  background read does not race with the NetCDF operations of the main
+ *  thread because every call to the NetCDF library through ncutils holds a
+ *  process-wide lock.
  */
 void load_turb_plane_data(
     const std::string& turb_filename,
@@ -156,57 +270,72 @@ void load_turb_plane_data(
 {
     BL_PROFILE("amr-wind::SyntheticTurbulence::load_plane_data");
 #ifdef AMR_WIND_USE_NETCDF
-    auto ncf = ncutils::NCFile::open(turb_filename, NC_NOWRITE);
-
-    // clang-format off
-    std::vector<size_t> start{{static_cast<size_t>(il), 0, 0}};
-    std::vector<size_t> count{{2, static_cast<size_t>(turb_grid.box_dims[1]),
-                               static_cast<size_t>(turb_grid.box_dims[2])}};
-    // clang-format on
-
-    auto uvel = ncf.var("uvel");
-    auto vvel = ncf.var("vvel");
-    auto wvel = ncf.var("wvel");
-
-    if ((ir - il) == 1) {
-        // two consequtive planes load them in one shot
-        uvel.get(&turb_grid.uvel[0], start, count);
-        vvel.get(&turb_grid.vvel[0], start, count);
-        wvel.get(&turb_grid.wvel[0], start, count);
-    } else {
-        // Load the planes separately
-        count[0] = 1;
-        uvel.get(&turb_grid.uvel[0], start, count);
-        vvel.get(&turb_grid.vvel[0], start, count);
-        wvel.get(&turb_grid.wvel[0], start, count);
-
-        start[0] = static_cast<size_t>(ir);
-        const size_t offset = turb_grid.box_dims[1] * turb_grid.box_dims[2];
-        uvel.get(&turb_grid.uvel[offset], start, count);
-        vvel.get(&turb_grid.vvel[offset], start, count);
-        wvel.get(&turb_grid.wvel[offset], start, count);
-    }
+    const int nx = turb_grid.box_dims[0];
+    const int stride =
+        (turb_grid.ileft < 0) ? 1 : ((il - turb_grid.ileft + nx) % nx);
 
     // Update left and right indices for future checks
     turb_grid.ileft = il;
     turb_grid.iright = ir;
 
-    ncf.close();
+    if (turb_grid.box_resident) {
+        return;
+    }
+
+    if (amrex::ParallelDescriptor::IOProcessor()) {
+        bool is_loaded = false;
+        if (turb_grid.prefetch.valid()) {
+            turb_grid.prefetch.get();
+            if ((turb_grid.prefetch_ileft == il) &&
+                (turb_grid.prefetch_iright == ir)) {
+                std::swap(turb_grid.vel, turb_grid.prefetch_vel);
+                is_loaded = true;
+                ++turb_grid.num_prefetch_hits;
+            } else {
+                ++turb_grid.num_prefetch_misses;
+                amrex::Print()
+                    << "SyntheticTurbulence: discarding prefetched planes ("
+                    << turb_grid.prefetch_ileft << ", "
+                    << turb_grid.prefetch_iright << "), reading planes ("
+                    << il << ", " << ir << ")" << std::endl;
+            }
+        }
+
+        if (!is_loaded) {
+            read_turb_plane_data(
+                turb_filename, turb_grid.box_dims, il, ir, turb_grid.vel);
+        }
+
+        if (turb_grid.prefetch_planes) {
+            const int pil = (il + amrex::max(stride, 1)) % nx;
+            const int pir = (pil + 1) % nx;
+            turb_grid.prefetch_ileft = pil;
+            turb_grid.prefetch_iright = pir;
+            turb_grid.prefetch = std::async(
+                std::launch::async, [&turb_grid, turb_filename, pil, pir] {
+                    read_turb_plane_data(
+                        turb_filename, turb_grid.box_dims, pil, pir,
+                        turb_grid.prefetch_vel);
+                });
+        }
+    }
+
+    amrex::ParallelDescriptor::Bcast(
+        turb_grid.vel.data(), turb_grid.vel.size(),
+        amrex::ParallelDescriptor::IOProcessorNumber());
 
     amrex::Gpu::copy(
-        amrex::Gpu::hostToDevice, turb_grid.uvel.begin(), turb_grid.uvel.end(),
-        turb_grid.uvel_d.begin());
-    amrex::Gpu::copy(
-        amrex::Gpu::hostToDevice, turb_grid.vvel.begin(), turb_grid.vvel.end(),
-        turb_grid.vvel_d.begin());
-    amrex::Gpu::copy(
-        amrex::Gpu::hostToDevice, turb_grid.wvel.begin(), turb_grid.wvel.end(),
-        turb_grid.wvel_d.begin());
+        amrex::Gpu::hostToDevice, turb_grid.vel.begin(), turb_grid.vel.end(),
+        turb_grid.vel_d.begin());
 #else
     amrex::ignore_unused(turb_filename, turb_grid, il, ir);
 #endif
 }
 
+} // namespace synth_turb
+
+namespace {
+
 /** Determine the left/right indices for a given point along a particular
  * direction
  *
@@ -306,43 +435,26 @@ AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE void interp_perturb_vel(
     const int nynz = t_grid.box_dims[1] * t_grid.box_dims[2];
     // clang-format off
     // Indices of the 2-D cell that contains the sampling point
-    int qidx[4]{wt.jl * nz + wt.kl, wt.jr * nz + wt.kl, wt.jr * nz + wt.kr,
-                wt.jl * nz + wt.kr};
+    const int qidx[4]{wt.jl * nz + wt.kl, wt.jr * nz + wt.kl,
+                      wt.jr * nz + wt.kr, wt.jl * nz + wt.kr};
     // clang-format on
-
-    vs::Vector vel_l, vel_r;
+    const amrex::Real qwts[4]{
+        wt.yl * wt.zl, wt.yr * wt.zl, wt.yr * wt.zr, wt.yl * wt.zr};
 
     // Left quad (t = t)
-    vel_l[0] = wt.yl * wt.zl * t_grid.uvel[qidx[0]] +
-               wt.yr * wt.zl * t_grid.uvel[qidx[1]] +
-               wt.yr * wt.zr * t_grid.uvel[qidx[2]] +
-               wt.yl * wt.zr * t_grid.uvel[qidx[3]];
-    vel_l[1] = wt.yl * wt.zl * t_grid.vvel[qidx[0]] +
-               wt.yr * wt.zl * t_grid.vvel[qidx[1]] +
-               wt.yr * wt.zr * t_grid.vvel[qidx[2]] +
-               wt.yl * wt.zr * t_grid.vvel[qidx[3]];
-    vel_l[2] = wt.yl * wt.zl * t_grid.wvel[qidx[0]] +
-               wt.yr * wt.zl * t_grid.wvel[qidx[1]] +
-               wt.yr * wt.zr * t_grid.wvel[qidx[2]] +
-               wt.yl * wt.zr * t_grid.wvel[qidx[3]];
-
-    for (int& i : qidx) {
-        i += nynz;
-    }
-
+    const double* vl = &t_grid.vel[t_grid.pleft * nynz * AMREX_SPACEDIM];
     // Right quad (t = t+deltaT)
-    vel_r[0] = wt.yl * wt.zl * t_grid.uvel[qidx[0]] +
-               wt.yr * wt.zl * t_grid.uvel[qidx[1]] +
-               wt.yr * wt.zr * t_grid.uvel[qidx[2]] +
-               wt.yl * wt.zr * t_grid.uvel[qidx[3]];
-    vel_r[1] = wt.yl * wt.zl * t_grid.vvel[qidx[0]] +
-               wt.yr * wt.zl * t_grid.vvel[qidx[1]] +
-               wt.yr * wt.zr * t_grid.vvel[qidx[2]] +
-               wt.yl * wt.zr * t_grid.vvel[qidx[3]];
-    vel_r[2] = wt.yl * wt.zl * t_grid.wvel[qidx[0]] +
-               wt.yr * wt.zl * t_grid.wvel[qidx[1]] +
-               wt.yr * wt.zr * t_grid.wvel[qidx[2]] +
-               wt.yl * wt.zr * t_grid.wvel[qidx[3]];
+    const double* vr = &t_grid.vel[t_grid.pright * nynz * AMREX_SPACEDIM];
+
+    vs::Vector vel_l{0.0, 0.0, 0.0};
+    vs::Vector vel_r{0.0, 0.0, 0.0};
+    for (int q = 0; q < 4; ++q) {
+        const int idx = qidx[q] * AMREX_SPACEDIM;
+        for (int n = 0; n < AMREX_SPACEDIM; ++n) {
+            vel_l[n] += qwts[q] * vl[idx + n];
+            vel_r[n] += qwts[q] * vr[idx + n];
+        }
+    }
 
     // Interpolation in time
     vel = wt.xl * vel_l + wt.xr * vel_r;
@@ -368,7 +480,11 @@ SyntheticTurbulence::SyntheticTurbulence(const CFDSim& sim)
 
     // NetCDF file containing the turbulence data
     pp.query("turbulence_file", m_turb_filename);
-    process_nc_file(m_turb_filename, m_turb_grid);
+    // Keep the entire turbulence box in memory instead of streaming planes
+    pp.query("keep_box_in_memory", m_turb_grid.box_resident);
+    // Read the upcoming planes in the background
+    pp.query("prefetch_planes", m_turb_grid.prefetch_planes);
+    synth_turb::process_nc_file(m_turb_filename, m_turb_grid);
 
     // Load position and orientation of the grid
     amrex::Real wind_direction{270.};
@@ -474,7 +590,10 @@ SyntheticTurbulence::SyntheticTurbulence(const CFDSim& sim)
                    << "  Mean wind profile: U = "
                    << m_wind_profile->reference_velocity()
                    << " m/s; Dir = " << wind_direction
-                   << " deg; type = " << mean_wind_type << std::endl;
+                   << " deg; type = " << mean_wind_type << "\n"
+                   << "  Box in memory = " << m_turb_grid.box_resident
+                   << "; Prefetch planes = " << m_turb_grid.prefetch_planes
+                   << std::endl;
 }
 
 void SyntheticTurbulence::initialize_fields(
@@ -499,7 +618,7 @@ void SyntheticTurbulence::initialize()
     const amrex::Real eqivLen = m_wind_profile->reference_velocity() * curTime;
     int il, ir;
     get_lr_indices(m_turb_grid, 0, eqivLen, il, ir);
-    load_turb_plane_data(m_turb_filename, m_turb_grid, il, ir);
+    synth_turb::load_turb_plane_data(m_turb_filename, m_turb_grid, il, ir);
 
     m_is_init = false;
 }
@@ -529,8 +648,9 @@ void SyntheticTurbulence::update()
 
     // Check if we need to refresh the planes
     if (weights.il != m_turb_grid.ileft) {
-        load_turb_plane_data(
+        synth_turb::load_turb_plane_data(
             m_turb_filename, m_turb_grid, weights.il, weights.ir);
+        turb_grid = SynthTurbDeviceData(m_turb_grid);
     }
 
     if (m_mean_wind_type == "ConstValue") {
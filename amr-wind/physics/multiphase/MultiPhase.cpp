@@ -4,6 +4,7 @@
 #include "AMReX_ParmParse.H"
 #include "amr-wind/fvm/filter.H"
 #include "amr-wind/core/field_ops.H"
+#include "amr-wind/core/mfiter_loops.H"
 #include "amr-wind/equation_systems/BCOps.H"
 #include <AMReX_MultiFabUtil.H>
 #include "amr-wind/core/SimTime.H"
@@ -133,41 +134,42 @@ amrex::Real MultiPhase::volume_fraction_sum()
     BL_PROFILE("amr-wind::multiphase::ComputeVolumeFractionSum");
     const int nlevels = m_sim.repo().num_active_levels();
     const auto& geom = m_sim.mesh().Geom();
-    const auto& mesh = m_sim.mesh();
+    auto& fine_masks = m_sim.repo().fine_masks();
 
     amrex::Real total_volume_frac = 0.0;
 
     for (int lev = 0; lev < nlevels; ++lev) {
 
-        amrex::iMultiFab level_mask;
-        if (lev < nlevels - 1) {
-            level_mask = makeFineMask(
-                mesh.boxArray(lev), mesh.DistributionMap(lev),
-                mesh.boxArray(lev + 1), amrex::IntVect(2), 1, 0);
-        } else {
-            level_mask.define(
-                mesh.boxArray(lev), mesh.DistributionMap(lev), 1, 0,
-                amrex::MFInfo());
-            level_mask.setVal(1);
-        }
+        // Only visit the tiles that are not covered by a finer level
+        const auto& level_mask = fine_masks.cell_mask(lev);
+        const auto& tiles = fine_masks.uncovered_tiles(lev);
+        const int ntiles = static_cast<int>(tiles.size());
 
-        auto& vof = (*m_vof)(lev);
+        const auto& vof = (*m_vof)(lev);
         const amrex::Real cell_vol = geom[lev].CellSize()[0] *
                                      geom[lev].CellSize()[1] *
                                      geom[lev].CellSize()[2];
 
-        total_volume_frac += amrex::ReduceSum(
-            vof, level_mask, 0,
-            [=] AMREX_GPU_HOST_DEVICE(
-                amrex::Box const& bx,
-                amrex::Array4<amrex::Real const> const& volfrac,
-                amrex::Array4<int const> const& mask_arr) -> amrex::Real {
-                amrex::Real vol_fab = 0.0;
-                amrex::Loop(bx, [=, &vol_fab](int i, int j, int k) noexcept {
-                    vol_fab += volfrac(i, j, k) * mask_arr(i, j, k) * cell_vol;
+        amrex::ReduceOps<amrex::ReduceOpSum> reduce_op;
+        amrex::ReduceData<amrex::Real> reduce_data(reduce_op);
+        using ReduceTuple = typename decltype(reduce_data)::Type;
+
+#ifdef AMREX_USE_OMP
+#pragma omp parallel for if (amrex::Gpu::notInLaunchRegion())
+#endif
+        for (int it = 0; it < ntiles; ++it) {
+            const auto& tile = tiles[it];
+            const auto& volfrac = vof.const_array(tile.index);
+            const auto& mask_arr = level_mask.const_array(tile.index);
+            const bool use_mask = tile.partially_covered;
+            reduce_op.eval(
+                tile.box, reduce_data,
+                [=] AMREX_GPU_DEVICE(int i, int j, int k) -> ReduceTuple {
+                    const int mask = use_mask ? mask_arr(i, j, k) : 1;
+                    return {volfrac(i, j, k) * mask * cell_vol};
                 });
-                return vol_fab;
-            });
+        }
+        total_volume_frac += amrex::get<0>(reduce_data.value(reduce_op));
     }
     amrex::ParallelDescriptor::ReduceRealSum(total_volume_frac);
 
@@ -180,44 +182,44 @@ amrex::Real MultiPhase::momentum_sum(int n)
     BL_PROFILE("amr-wind::multiphase::ComputeVolumeFractionSum");
     const int nlevels = m_sim.repo().num_active_levels();
     const auto& geom = m_sim.mesh().Geom();
-    const auto& mesh = m_sim.mesh();
+    auto& fine_masks = m_sim.repo().fine_masks();
 
     amrex::Real total_momentum = 0.0;
 
     for (int lev = 0; lev < nlevels; ++lev) {
 
-        amrex::iMultiFab level_mask;
-        if (lev < nlevels - 1) {
-            level_mask = makeFineMask(
-                mesh.boxArray(lev), mesh.DistributionMap(lev),
-                mesh.boxArray(lev + 1), amrex::IntVect(2), 1, 0);
-        } else {
-            level_mask.define(
-                mesh.boxArray(lev), mesh.DistributionMap(lev), 1, 0,
-                amrex::MFInfo());
-            level_mask.setVal(1);
-        }
+        // Only visit the tiles that are not covered by a finer level
+        const auto& level_mask = fine_masks.cell_mask(lev);
+        const auto& tiles = fine_masks.uncovered_tiles(lev);
+        const int ntiles = static_cast<int>(tiles.size());
 
-        auto& velocity = m_sim.repo().get_field("velocity")(lev);
-        auto& density = m_sim.repo().get_field("density")(lev);
+        const auto& velocity = m_sim.repo().get_field("velocity")(lev);
+        const auto& density = m_sim.repo().get_field("density")(lev);
         const amrex::Real cell_vol = geom[lev].CellSize()[0] *
                                      geom[lev].CellSize()[1] *
                                      geom[lev].CellSize()[2];
 
-        total_momentum += amrex::ReduceSum(
-            velocity, density, level_mask, 0,
-            [=] AMREX_GPU_HOST_DEVICE(
-                amrex::Box const& bx,
-                amrex::Array4<amrex::Real const> const& vel,
-                amrex::Array4<amrex::Real const> const& dens,
-                amrex::Array4<int const> const& mask_arr) -> amrex::Real {
-                amrex::Real vol_fab = 0.0;
-                amrex::Loop(bx, [=, &vol_fab](int i, int j, int k) noexcept {
-                    vol_fab += vel(i, j, k, n) * dens(i, j, k) *
-                               mask_arr(i, j, k) * cell_vol;
+        amrex::ReduceOps<amrex::ReduceOpSum> reduce_op;
+        amrex::ReduceData<amrex::Real> reduce_data(reduce_op);
+        using ReduceTuple = typename decltype(reduce_data)::Type;
+
+#ifdef AMREX_USE_OMP
+#pragma omp parallel for if (amrex::Gpu::notInLaunchRegion())
+#endif
+        for (int it = 0; it < ntiles; ++it) {
+            const auto& tile = tiles[it];
+            const auto& vel = velocity.const_array(tile.index);
+            const auto& dens = density.const_array(tile.index);
+            const auto& mask_arr = level_mask.const_array(tile.index);
+            const bool use_mask = tile.partially_covered;
+            reduce_op.eval(
+                tile.box, reduce_data,
+                [=] AMREX_GPU_DEVICE(int i, int j, int k) -> ReduceTuple {
+                    const int mask = use_mask ? mask_arr(i, j, k) : 1;
+                    return {vel(i, j, k, n) * dens(i, j, k) * mask * cell_vol};
                 });
-                return vol_fab;
-            });
+        }
+        total_momentum += amrex::get<0>(reduce_data.value(reduce_op));
     }
     amrex::ParallelDescriptor::ReduceRealSum(total_momentum);
 
@@ -226,6 +228,7 @@ amrex::Real MultiPhase::momentum_sum(int n)
 
 void MultiPhase::set_density_via_levelset()
 {
+    BL_PROFILE("amr-wind::multiphase::set_density_via_levelset");
     const int nlevels = m_sim.repo().num_active_levels();
     const auto& geom = m_sim.mesh().Geom();
 
@@ -233,8 +236,8 @@ void MultiPhase::set_density_via_levelset()
         auto& density = m_density(lev);
         auto& levelset = (*m_levelset)(lev);
 
-        for (amrex::MFIter mfi(density); mfi.isValid(); ++mfi) {
-            const auto& vbx = mfi.validbox();
+        for_each_tile(density, [&](const amrex::MFIter& mfi) {
+            const auto& vbx = mfi.tilebox();
             const auto& dx = geom[lev].CellSizeArray();
 
             const amrex::Array4<amrex::Real>& phi = levelset.array(mfi);
@@ -258,21 +261,22 @@ void MultiPhase::set_density_via_levelset()
                     rho(i, j, k) = captured_rho1 * smooth_heaviside +
                                    captured_rho2 * (1.0 - smooth_heaviside);
                 });
-        }
+        });
     }
     m_density.fillpatch(m_sim.time().current_time());
 }
 
 void MultiPhase::set_density_via_vof()
 {
+    BL_PROFILE("amr-wind::multiphase::set_density_via_vof");
     const int nlevels = m_sim.repo().num_active_levels();
 
     for (int lev = 0; lev < nlevels; ++lev) {
         auto& density = m_density(lev);
         auto& vof = (*m_vof)(lev);
 
-        for (amrex::MFIter mfi(density); mfi.isValid(); ++mfi) {
-            const auto& vbx = mfi.validbox();
+        for_each_tile(density, [&](const amrex::MFIter& mfi) {
+            const auto& vbx = mfi.tilebox();
             const amrex::Array4<amrex::Real>& F = vof.array(mfi);
             const amrex::Array4<amrex::Real>& rho = density.array(mfi);
             const amrex::Real captured_rho1 = m_rho1;
@@ -282,7 +286,7 @@ void MultiPhase::set_density_via_vof()
                     rho(i, j, k) = captured_rho1 * F(i, j, k) +
                                    captured_rho2 * (1.0 - F(i, j, k));
                 });
-        }
+        });
     }
     m_density.fillpatch(m_sim.time().current_time());
 }
@@ -313,12 +317,13 @@ void MultiPhase::calculate_advected_facedensity()
 
     for (int lev = 0; lev < nlevels; ++lev) {
 
-        for (amrex::MFIter mfi((*m_vof)(lev)); mfi.isValid(); ++mfi) {
+        for_each_tile((*m_vof)(lev), [&](const amrex::MFIter& mfi) {
             const auto& bx = mfi.tilebox();
             const auto& bxg1 = amrex::grow(bx, 1);
-            const auto& xbx = amrex::surroundingNodes(bx, 0);
-            const auto& ybx = amrex::surroundingNodes(bx, 1);
-            const auto& zbx = amrex::surroundingNodes(bx, 2);
+            // Faces shared by adjacent tiles belong to only one of them
+            const auto& xbx = mfi.nodaltilebox(0);
+            const auto& ybx = mfi.nodaltilebox(1);
+            const auto& zbx = mfi.nodaltilebox(2);
 
             auto aa_x = advalpha_x(lev).array(mfi);
             auto aa_y = advalpha_y(lev).array(mfi);
@@ -340,7 +345,7 @@ void MultiPhase::calculate_advected_facedensity()
                             c_r1 * aa_z(i, j, k) + c_r2 * (1.0 - aa_z(i, j, k));
                     }
                 });
-        }
+        });
     }
 }
 
@@ -361,7 +366,7 @@ void MultiPhase::favre_filtering()
         auto& velocity = m_velocity(lev);
         auto& density = m_density(lev);
 
-        for (amrex::MFIter mfi(velocity); mfi.isValid(); ++mfi) {
+        for_each_tile(velocity, [&](const amrex::MFIter& mfi) {
             const auto& bx = mfi.growntilebox(1);
             const amrex::Array4<amrex::Real>& vel = velocity.array(mfi);
             const amrex::Array4<amrex::Real>& rho = density.array(mfi);
@@ -371,7 +376,7 @@ void MultiPhase::favre_filtering()
                 [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
                     rhou(i, j, k, n) = vel(i, j, k, n) * rho(i, j, k);
                 });
-        }
+        });
     }
     // Do the filtering
     fvm::filter((*density_filter), m_density);
@@ -382,8 +387,8 @@ void MultiPhase::favre_filtering()
         auto& vof = (*m_vof)(lev);
         auto& mom_fil = (*momentum_filter)(lev);
         auto& rho_fil = (*density_filter)(lev);
-        for (amrex::MFIter mfi(velocity); mfi.isValid(); ++mfi) {
-            const auto& vbx = mfi.validbox();
+        for_each_tile(velocity, [&](const amrex::MFIter& mfi) {
+            const auto& vbx = mfi.tilebox();
             const amrex::Array4<amrex::Real>& vel = velocity.array(mfi);
             const amrex::Array4<amrex::Real>& volfrac = vof.array(mfi);
             const amrex::Array4<amrex::Real>& rho_u_f = mom_fil.array(mfi);
@@ -395,7 +400,7 @@ void MultiPhase::favre_filtering()
                         vel(i, j, k, n) = rho_u_f(i, j, k, n) / rho_f(i, j, k);
                     }
                 });
-        }
+        });
     }
     m_velocity.fillpatch(0.0);
 }
@@ -412,8 +417,8 @@ void MultiPhase::levelset2vof()
         auto& vof = (*m_vof)(lev);
         const auto& dx = geom[lev].CellSizeArray();
 
-        for (amrex::MFIter mfi(levelset); mfi.isValid(); ++mfi) {
-            const auto& vbx = mfi.validbox();
+        for_each_tile(levelset, [&](const amrex::MFIter& mfi) {
+            const auto& vbx = mfi.tilebox();
             const amrex::Array4<amrex::Real>& phi = levelset.array(mfi);
             const amrex::Array4<amrex::Real>& volfrac = vof.array(mfi);
             const amrex::Real eps = 2. * std::cbrt(dx[0] * dx[1] * dx[2]);
@@ -446,7 +451,7 @@ void MultiPhase::levelset2vof()
                             multiphase::cut_volume(mx, my, mz, alpha, 0.0, 1.0);
                     }
                 });
-        }
+        });
     }
     // Fill ghost and boundary cells before simulation begins
     (*m_vof).fillpatch(0.0);
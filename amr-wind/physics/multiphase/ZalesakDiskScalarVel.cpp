@@ -221,17 +221,10 @@ amrex::Real ZalesakDiskScalarVel::compute_error(const Field& field)
     const int nlevels = m_sim.repo().num_active_levels();
     for (int lev = 0; lev < nlevels; ++lev) {
 
-        amrex::iMultiFab level_mask;
-        if (lev < nlevels - 1) {
-            level_mask = makeFineMask(
-                m_sim.mesh().boxArray(lev), m_sim.mesh().DistributionMap(lev),
-                m_sim.mesh().boxArray(lev + 1), amrex::IntVect(2), 1, 0);
-        } else {
-            level_mask.define(
-                m_sim.mesh().boxArray(lev), m_sim.mesh().DistributionMap(lev),
-                1, 0, amrex::MFInfo());
-            level_mask.setVal(1);
-        }
+        const auto& fine_mask = m_sim.repo().fine_masks().cell_mask(lev);
+        amrex::iMultiFab level_mask(
+            fine_mask.boxArray(), fine_mask.DistributionMap(), 1, 0);
+        amrex::iMultiFab::Copy(level_mask, fine_mask, 0, 0, 1, 0);
 
         if (m_sim.has_overset()) {
             for (amrex::MFIter mfi(field(lev)); mfi.isValid(); ++mfi) {
@@ -4,10 +4,114 @@
 #include "amr-wind/core/MLMGOptions.H"
 #include "amr-wind/utilities/console_io.H"
 #include "amr-wind/core/field_ops.H"
+#include "amr-wind/core/kernel_variants.H"
 #include "amr-wind/wind_energy/ABL.H"
 
 using namespace amrex;
 
+namespace {
+
+/** Add the pressure gradient back to the velocity
+ *
+ *  Accounts for mesh mapping in ( grad p /ro ) ->  1/fac * grad(p) * dt/rho
+ */
+template <bool MeshMapping>
+void add_pressure_gradient(
+    amr_wind::Field& velocity,
+    const Vector<MultiFab const*>& density,
+    const amr_wind::Field& grad_p,
+    amr_wind::Field const* mesh_fac,
+    const Real scaling_factor,
+    const int nlevels)
+{
+    const bool mesh_mapping = (mesh_fac != nullptr);
+    for (int lev = 0; lev < nlevels; lev++) {
+
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+        for (MFIter mfi(velocity(lev), TilingIfNotGPU()); mfi.isValid();
+             ++mfi) {
+            Box const& bx = mfi.tilebox();
+            Array4<Real> const& u = velocity(lev).array(mfi);
+            Array4<Real const> const& rho = density[lev]->const_array(mfi);
+            Array4<Real const> const& gp = grad_p(lev).const_array(mfi);
+            amrex::Array4<amrex::Real const> fac =
+                mesh_mapping ? ((*mesh_fac)(lev).const_array(mfi))
+                             : amrex::Array4<amrex::Real const>();
+
+            amrex::ParallelFor(
+                bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                    Real soverrho = scaling_factor / rho(i, j, k);
+                    amrex::Real fac_x = (MeshMapping && mesh_mapping)
+                                            ? (fac(i, j, k, 0))
+                                            : 1.0;
+                    amrex::Real fac_y = (MeshMapping && mesh_mapping)
+                                            ? (fac(i, j, k, 1))
+                                            : 1.0;
+                    amrex::Real fac_z = (MeshMapping && mesh_mapping)
+                                            ? (fac(i, j, k, 2))
+                                            : 1.0;
+
+                    u(i, j, k, 0) += 1 / fac_x * gp(i, j, k, 0) * soverrho;
+                    u(i, j, k, 1) += 1 / fac_y * gp(i, j, k, 1) * soverrho;
+                    u(i, j, k, 2) += 1 / fac_z * gp(i, j, k, 2) * soverrho;
+                });
+        }
+    }
+}
+
+/** Compute sigma while accounting for mesh mapping
+ *
+ *  sigma = 1/(fac^2)*J * dt/rho
+ */
+template <bool MeshMapping>
+void compute_sigma(
+    Vector<amrex::MultiFab>& sigma,
+    const Vector<MultiFab const*>& density,
+    amr_wind::Field const* mesh_fac,
+    amr_wind::Field const* mesh_detJ,
+    const Real scaling_factor)
+{
+    const bool mesh_mapping = (mesh_fac != nullptr);
+    const int ncomp = mesh_mapping ? AMREX_SPACEDIM : 1;
+    const int nlevels = static_cast<int>(sigma.size());
+    for (int lev = 0; lev < nlevels; ++lev) {
+        sigma[lev].define(
+            density[lev]->boxArray(), density[lev]->DistributionMap(), ncomp,
+            0, MFInfo(), density[lev]->Factory());
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+        for (MFIter mfi(sigma[lev], TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+            Box const& bx = mfi.tilebox();
+            Array4<Real> const& sig = sigma[lev].array(mfi);
+            Array4<Real const> const& rho = density[lev]->const_array(mfi);
+            amrex::Array4<amrex::Real const> fac =
+                mesh_mapping ? ((*mesh_fac)(lev).const_array(mfi))
+                             : amrex::Array4<amrex::Real const>();
+            amrex::Array4<amrex::Real const> detJ =
+                mesh_mapping ? ((*mesh_detJ)(lev).const_array(mfi))
+                             : amrex::Array4<amrex::Real const>();
+
+            amrex::ParallelFor(
+                bx, ncomp,
+                [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
+                    amrex::Real fac_cc = (MeshMapping && mesh_mapping)
+                                             ? (fac(i, j, k, n))
+                                             : 1.0;
+                    amrex::Real det_j = (MeshMapping && mesh_mapping)
+                                            ? (detJ(i, j, k))
+                                            : 1.0;
+                    sig(i, j, k, n) = std::pow(fac_cc, -2.) * det_j *
+                                      scaling_factor / rho(i, j, k);
+                });
+        }
+    }
+}
+
+} // namespace
+
 void incflo::set_inflow_velocity(
     int lev, amrex::Real time, MultiFab& vel, int nghost)
 {
@@ -159,37 +263,11 @@ void incflo::ApplyProjection(
     // Also account for mesh mapping in ( grad p /ro ) ->  1/fac * grad(p) *
     // dt/rho
     if (!incremental) {
-        for (int lev = 0; lev <= finest_level; lev++) {
-
-#ifdef AMREX_USE_OMP
-#pragma omp parallel if (Gpu::notInLaunchRegion())
-#endif
-            for (MFIter mfi(velocity(lev), TilingIfNotGPU()); mfi.isValid();
-                 ++mfi) {
-                Box const& bx = mfi.tilebox();
-                Array4<Real> const& u = velocity(lev).array(mfi);
-                Array4<Real const> const& rho = density[lev]->const_array(mfi);
-                Array4<Real const> const& gp = grad_p(lev).const_array(mfi);
-                amrex::Array4<amrex::Real const> fac =
-                    mesh_mapping ? ((*mesh_fac)(lev).const_array(mfi))
-                                 : amrex::Array4<amrex::Real const>();
-
-                amrex::ParallelFor(
-                    bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-                        Real soverrho = scaling_factor / rho(i, j, k);
-                        amrex::Real fac_x =
-                            mesh_mapping ? (fac(i, j, k, 0)) : 1.0;
-                        amrex::Real fac_y =
-                            mesh_mapping ? (fac(i, j, k, 1)) : 1.0;
-                        amrex::Real fac_z =
-                            mesh_mapping ? (fac(i, j, k, 2)) : 1.0;
-
-                        u(i, j, k, 0) += 1 / fac_x * gp(i, j, k, 0) * soverrho;
-                        u(i, j, k, 1) += 1 / fac_y * gp(i, j, k, 1) * soverrho;
-                        u(i, j, k, 2) += 1 / fac_z * gp(i, j, k, 2) * soverrho;
-                    });
-            }
-        }
+        amr_wind::dispatch_mesh_mapping(mesh_mapping, [&](auto mm) {
+            add_pressure_gradient<decltype(mm)::value>(
+                velocity, density, grad_p, mesh_fac, scaling_factor,
+                finest_level + 1);
+        });
     }
 
     bool add_surface_tension = m_sim.physics_manager().contains("MultiPhase");
@@ -248,37 +326,10 @@ void incflo::ApplyProjection(
     // sigma = 1/(fac^2)*J * dt/rho
     Vector<amrex::MultiFab> sigma(finest_level + 1);
     if (variable_density || mesh_mapping) {
-        int ncomp = mesh_mapping ? AMREX_SPACEDIM : 1;
-        for (int lev = 0; lev <= finest_level; ++lev) {
-            sigma[lev].define(
-                grids[lev], dmap[lev], ncomp, 0, MFInfo(), Factory(lev));
-#ifdef AMREX_USE_OMP
-#pragma omp parallel if (Gpu::notInLaunchRegion())
-#endif
-            for (MFIter mfi(sigma[lev], TilingIfNotGPU()); mfi.isValid();
-                 ++mfi) {
-                Box const& bx = mfi.tilebox();
-                Array4<Real> const& sig = sigma[lev].array(mfi);
-                Array4<Real const> const& rho = density[lev]->const_array(mfi);
-                amrex::Array4<amrex::Real const> fac =
-                    mesh_mapping ? ((*mesh_fac)(lev).const_array(mfi))
-                                 : amrex::Array4<amrex::Real const>();
-                amrex::Array4<amrex::Real const> detJ =
-                    mesh_mapping ? ((*mesh_detJ)(lev).const_array(mfi))
-                                 : amrex::Array4<amrex::Real const>();
-
-                amrex::ParallelFor(
-                    bx, ncomp,
-                    [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
-                        amrex::Real fac_cc =
-                            mesh_mapping ? (fac(i, j, k, n)) : 1.0;
-                        amrex::Real det_j =
-                            mesh_mapping ? (detJ(i, j, k)) : 1.0;
-                        sig(i, j, k, n) = std::pow(fac_cc, -2.) * det_j *
-                                          scaling_factor / rho(i, j, k);
-                    });
-            }
-        }
+        amr_wind::dispatch_mesh_mapping(mesh_mapping, [&](auto mm) {
+            compute_sigma<decltype(mm)::value>(
+                sigma, density, mesh_fac, mesh_detJ, scaling_factor);
+        });
     }
 
     // Perform projection
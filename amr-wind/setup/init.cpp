@@ -29,6 +29,12 @@ void incflo::ReadParameters()
         // Godunov-related flags
         pp.query("use_godunov", m_use_godunov);
 
+        // Field memory management
+        bool lazy_alloc = false;
+        pp.query("lazy_field_allocation", lazy_alloc);
+        m_repo.set_lazy_allocation(lazy_alloc);
+        pp.query("field_memory_report", m_field_memory_report);
+
         // The default for diffusion_type is 2, i.e. the default m_diff_type is
         // DiffusionType::Implicit
         int diffusion_type = 1;
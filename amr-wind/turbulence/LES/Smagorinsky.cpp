@@ -3,6 +3,7 @@
 #include "amr-wind/turbulence/LES/Smagorinsky.H"
 #include "amr-wind/turbulence/TurbModelDefs.H"
 #include "amr-wind/fvm/strainrate.H"
+#include "amr-wind/core/mfiter_loops.H"
 #include "AMReX_REAL.H"
 #include "AMReX_MultiFab.H"
 #include "AMReX_ParmParse.H"
@@ -46,7 +47,7 @@ void Smagorinsky<Transport>::update_turbulent_viscosity(const FieldState fstate)
         const amrex::Real ds_sqr = ds * ds;
         const amrex::Real smag_factor = Cs_sqr * ds_sqr;
 
-        for (amrex::MFIter mfi(mu_turb(lev)); mfi.isValid(); ++mfi) {
+        for_each_tile(mu_turb(lev), [&](const amrex::MFIter& mfi) {
             const auto& bx = mfi.tilebox();
             const auto& mu_arr = mu_turb(lev).array(mfi);
             const auto& rho_arr = den(lev).const_array(mfi);
@@ -56,7 +57,7 @@ void Smagorinsky<Transport>::update_turbulent_viscosity(const FieldState fstate)
                     const amrex::Real rho = rho_arr(i, j, k);
                     mu_arr(i, j, k) *= rho * smag_factor;
                 });
-        }
+        });
     }
 
     mu_turb.fillpatch(this->m_sim.time().current_time());
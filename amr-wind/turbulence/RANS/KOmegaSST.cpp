@@ -5,6 +5,7 @@
 #include "amr-wind/fvm/gradient.H"
 #include "amr-wind/fvm/strainrate.H"
 #include "amr-wind/turbulence/turb_utils.H"
+#include "amr-wind/core/mfiter_loops.H"
 #include "amr-wind/equation_systems/tke/TKE.H"
 #include "amr-wind/equation_systems/sdr/SDR.H"
 
@@ -110,7 +111,7 @@ void KOmegaSST<Transport>::update_turbulent_viscosity(const FieldState fstate)
     const amrex::Real sigmat = this->m_sigma_t;
 
     for (int lev = 0; lev < nlevels; ++lev) {
-        for (amrex::MFIter mfi(mu_turb(lev)); mfi.isValid(); ++mfi) {
+        for_each_tile(mu_turb(lev), [&](const amrex::MFIter& mfi) {
             const auto& bx = mfi.tilebox();
             const auto& lam_mu_arr = (*lam_mu)(lev).array(mfi);
             const auto& mu_arr = mu_turb(lev).array(mfi);
@@ -201,7 +202,7 @@ void KOmegaSST<Transport>::update_turbulent_viscosity(const FieldState fstate)
                     sdr_diss_arr(i, j, k) = -rho_arr(i, j, k) * beta *
                                             sdr_arr(i, j, k) * sdr_arr(i, j, k);
                 });
-        }
+        });
     }
 
     mu_turb.fillpatch(this->m_sim.time().current_time());
@@ -223,7 +224,7 @@ void KOmegaSST<Transport>::update_scalar_diff(
         const auto& repo = deff.repo();
         const int nlevels = repo.num_active_levels();
         for (int lev = 0; lev < nlevels; ++lev) {
-            for (amrex::MFIter mfi(deff(lev)); mfi.isValid(); ++mfi) {
+            for_each_tile(deff(lev), [&](const amrex::MFIter& mfi) {
                 const auto& bx = mfi.tilebox();
                 const auto& lam_mu_arr = (*lam_mu)(lev).array(mfi);
                 const auto& mu_arr = mu_turb(lev).array(mfi);
@@ -237,7 +238,7 @@ void KOmegaSST<Transport>::update_scalar_diff(
                              sigma_k2) *
                                 mu_arr(i, j, k);
                     });
-            }
+            });
         }
 
     } else if (name == pde::SDR::var_name()) {
@@ -246,7 +247,7 @@ void KOmegaSST<Transport>::update_scalar_diff(
         const auto& repo = deff.repo();
         const int nlevels = repo.num_active_levels();
         for (int lev = 0; lev < nlevels; ++lev) {
-            for (amrex::MFIter mfi(deff(lev)); mfi.isValid(); ++mfi) {
+            for_each_tile(deff(lev), [&](const amrex::MFIter& mfi) {
                 const auto& bx = mfi.tilebox();
                 const auto& lam_mu_arr = (*lam_mu)(lev).array(mfi);
                 const auto& mu_arr = mu_turb(lev).array(mfi);
@@ -260,7 +261,7 @@ void KOmegaSST<Transport>::update_scalar_diff(
                              sigma_omega2) *
                                 mu_arr(i, j, k);
                     });
-            }
+            });
         }
     } else {
         amrex::Abort(
@@ -0,0 +1,301 @@
+#include "amr-wind/utilities/BuddyCheckpoint.H"
+#include "amr-wind/CFDSim.H"
+
+#include "AMReX_ParmParse.H"
+#include "AMReX_ParallelDescriptor.H"
+#include "AMReX_MultiFab.H"
+#include "AMReX_Gpu.H"
+
+#include <climits>
+#include <limits>
+
+namespace amr_wind {
+
+BuddyCheckpoint::BuddyCheckpoint(
+    CFDSim& sim, const amrex::Vector<Field*>& fields)
+    : m_sim(sim), m_fields(fields)
+{}
+
+void BuddyCheckpoint::initialize()
+{
+    amrex::ParmParse pp("io");
+    pp.query("buddy_checkpoint_interval", m_interval);
+    pp.query("buddy_checkpoint_offset", m_offset);
+
+    amrex::Vector<int> fail_inp;
+    pp.queryarr("buddy_checkpoint_test_failure", fail_inp);
+    if (!fail_inp.empty()) {
+        AMREX_ALWAYS_ASSERT(fail_inp.size() == 2);
+        m_fail_step = fail_inp[0];
+        m_fail_rank = fail_inp[1];
+    }
+
+    const int nprocs = amrex::ParallelDescriptor::NProcs();
+    if (enabled() && (nprocs > 1) && ((m_offset % nprocs) == 0)) {
+        amrex::Abort(
+            "BuddyCheckpoint: io.buddy_checkpoint_offset places the copy on "
+            "the same rank");
+    }
+}
+
+bool BuddyCheckpoint::is_snapshot_step() const
+{
+    return enabled() && ((m_sim.time().time_index() % m_interval) == 0);
+}
+
+int BuddyCheckpoint::buddy_rank() const
+{
+    const int nprocs = amrex::ParallelDescriptor::NProcs();
+    const int offset = ((m_offset % nprocs) + nprocs) % nprocs;
+    return (amrex::ParallelDescriptor::MyProc() + offset) % nprocs;
+}
+
+int BuddyCheckpoint::ward_rank() const
+{
+    const int nprocs = amrex::ParallelDescriptor::NProcs();
+    const int offset = ((m_offset % nprocs) + nprocs) % nprocs;
+    return (amrex::ParallelDescriptor::MyProc() - offset + nprocs) % nprocs;
+}
+
+size_t BuddyCheckpoint::memory_footprint() const
+{
+    return (m_local_data.size() + m_buddy_data.size()) * sizeof(amrex::Real);
+}
+
+void BuddyCheckpoint::save()
+{
+    BL_PROFILE("amr-wind::BuddyCheckpoint::save");
+    const auto& time = m_sim.time();
+    const auto& mesh = m_sim.mesh();
+    const int nlevels = mesh.finestLevel() + 1;
+
+    amrex::Print() << "Saving in-memory checkpoint at step "
+                   << time.time_index() << std::endl;
+
+    m_ba.resize(nlevels);
+    m_dm.resize(nlevels);
+    for (int lev = 0; lev < nlevels; ++lev) {
+        m_ba[lev] = mesh.boxArray(lev);
+        m_dm[lev] = mesh.DistributionMap(lev);
+    }
+
+    pack(m_local_data);
+    exchange(m_local_data, buddy_rank(), m_buddy_data, ward_rank());
+
+    m_time_index = time.time_index();
+    m_new_time = time.new_time();
+    m_dt[0] = time.deltaT();
+    m_dt[1] = time.deltaTNm1();
+    m_dt[2] = time.deltaTNm2();
+}
+
+void BuddyCheckpoint::restore(const int lost_rank)
+{
+    BL_PROFILE("amr-wind::BuddyCheckpoint::restore");
+    if (!has_snapshot()) {
+        amrex::Abort("BuddyCheckpoint: no in-memory checkpoint to restore");
+    }
+    if (m_sim.mesh().finestLevel() + 1 != static_cast<int>(m_ba.size())) {
+        amrex::Abort(
+            "BuddyCheckpoint: the number of levels has changed since the "
+            "in-memory checkpoint was saved");
+    }
+
+    amrex::Print() << "Restoring in-memory checkpoint from step "
+                   << m_time_index << std::endl;
+
+    if (lost_rank >= 0) {
+        // The buddy of the lost rank sends its copy back
+        const int myproc = amrex::ParallelDescriptor::MyProc();
+        const int nprocs = amrex::ParallelDescriptor::NProcs();
+        const int offset = ((m_offset % nprocs) + nprocs) % nprocs;
+        const int holder = (lost_rank + offset) % nprocs;
+        amrex::Vector<amrex::Real> empty;
+        if (holder == lost_rank) {
+            if (myproc == lost_rank) {
+                m_local_data = m_buddy_data;
+            }
+        } else if (myproc == lost_rank) {
+            exchange(empty, -1, m_local_data, holder);
+        } else if (myproc == holder) {
+            exchange(m_buddy_data, lost_rank, empty, -1);
+        }
+    }
+
+    unpack(m_local_data);
+
+    // The lost rank also held the copy of its ward's data
+    if (lost_rank >= 0) {
+        exchange(m_local_data, buddy_rank(), m_buddy_data, ward_rank());
+    }
+
+    auto& time = m_sim.time();
+    time.set_restart_time(m_time_index, m_new_time);
+    time.deltaT() = m_dt[0];
+    time.deltaTNm1() = m_dt[1];
+    time.deltaTNm2() = m_dt[2];
+}
+
+bool BuddyCheckpoint::test_failure()
+{
+    if ((m_fail_step < 0) || (m_sim.time().time_index() != m_fail_step) ||
+        !has_snapshot()) {
+        return false;
+    }
+
+    // Only simulate the failure once
+    m_fail_step = -1;
+    const int lost_rank = m_fail_rank % amrex::ParallelDescriptor::NProcs();
+    amrex::Print() << "Simulating the loss of rank " << lost_rank
+                   << " at step " << m_sim.time().time_index() << std::endl;
+
+    if (amrex::ParallelDescriptor::MyProc() == lost_rank) {
+        const auto nan = std::numeric_limits<amrex::Real>::quiet_NaN();
+        const int nlevels = m_sim.mesh().finestLevel() + 1;
+        for (int lev = 0; lev < nlevels; ++lev) {
+            for (auto* fld : m_fields) {
+                auto& mf = (*fld)(lev);
+                for (amrex::MFIter mfi(mf); mfi.isValid(); ++mfi) {
+                    mf[mfi].setVal<amrex::RunOn::Device>(
+                        nan, mfi.validbox(), 0, mf.nComp());
+                }
+            }
+        }
+        m_local_data.clear();
+        // Without other ranks, the local copy of the buddy data stands in
+        // for the copy held by the buddy
+        if (amrex::ParallelDescriptor::NProcs() > 1) {
+            m_buddy_data.clear();
+        }
+    }
+
+    restore(lost_rank);
+    return true;
+}
+
+void BuddyCheckpoint::pack(amrex::Vector<amrex::Real>& buf)
+{
+    const int nlevels = static_cast<int>(m_ba.size());
+    size_t total = 0;
+    for (int lev = 0; lev < nlevels; ++lev) {
+        for (auto* fld : m_fields) {
+            const auto& mf = (*fld)(lev);
+            for (amrex::MFIter mfi(mf); mfi.isValid(); ++mfi) {
+                total += mfi.validbox().numPts() * mf.nComp();
+            }
+        }
+    }
+    buf.resize(total);
+
+    size_t offset = 0;
+    for (int lev = 0; lev < nlevels; ++lev) {
+        for (auto* fld : m_fields) {
+            const auto& mf = (*fld)(lev);
+            // Contiguous copy of the valid cells
+            amrex::MultiFab tmp(
+                mf.boxArray(), mf.DistributionMap(), mf.nComp(), 0);
+            amrex::MultiFab::Copy(tmp, mf, 0, 0, mf.nComp(), 0);
+            for (amrex::MFIter mfi(tmp); mfi.isValid(); ++mfi) {
+                const auto& fab = tmp[mfi];
+                const auto npts = static_cast<size_t>(fab.size());
+                amrex::Gpu::copy(
+                    amrex::Gpu::deviceToHost, fab.dataPtr(),
+                    fab.dataPtr() + npts, buf.data() + offset);
+                offset += npts;
+            }
+        }
+    }
+}
+
+void BuddyCheckpoint::unpack(const amrex::Vector<amrex::Real>& buf)
+{
+    const int nlevels = static_cast<int>(m_ba.size());
+    const auto& geom = m_sim.mesh().Geom();
+    size_t offset = 0;
+    for (int lev = 0; lev < nlevels; ++lev) {
+        for (auto* fld : m_fields) {
+            auto& mf = (*fld)(lev);
+            amrex::MultiFab tmp(
+                amrex::convert(m_ba[lev], mf.ixType()), m_dm[lev], mf.nComp(),
+                0);
+            for (amrex::MFIter mfi(tmp); mfi.isValid(); ++mfi) {
+                auto& fab = tmp[mfi];
+                const auto npts = static_cast<size_t>(fab.size());
+                AMREX_ALWAYS_ASSERT(offset + npts <= buf.size());
+                amrex::Gpu::copy(
+                    amrex::Gpu::hostToDevice, buf.data() + offset,
+                    buf.data() + offset + npts, fab.dataPtr());
+                offset += npts;
+            }
+
+            // The mesh might have been regridded since the snapshot
+            mf.ParallelCopy(tmp, 0, 0, mf.nComp());
+            mf.FillBoundary(geom[lev].periodicity());
+        }
+    }
+    AMREX_ALWAYS_ASSERT(offset == buf.size());
+}
+
+void BuddyCheckpoint::exchange(
+    const amrex::Vector<amrex::Real>& sendbuf,
+    const int dest,
+    amrex::Vector<amrex::Real>& recvbuf,
+    const int src)
+{
+    BL_PROFILE("amr-wind::BuddyCheckpoint::exchange");
+    const int myproc = amrex::ParallelDescriptor::MyProc();
+    if ((dest == myproc) && (src == myproc)) {
+        recvbuf = sendbuf;
+        return;
+    }
+
+#ifdef AMREX_USE_MPI
+    const auto comm = amrex::ParallelDescriptor::Communicator();
+    const auto dtype =
+        amrex::ParallelDescriptor::Mpi_typemap<amrex::Real>::type();
+    constexpr int size_tag = 4201;
+    constexpr int data_tag = 4202;
+
+    long long nsend = static_cast<long long>(sendbuf.size());
+    long long nrecv = 0;
+    MPI_Request reqs[2];
+    int nreq = 0;
+
+    // Exchange the message sizes before the data
+    if (src >= 0) {
+        MPI_Irecv(
+            &nrecv, 1, MPI_LONG_LONG, src, size_tag, comm, &reqs[nreq++]);
+    }
+    if (dest >= 0) {
+        MPI_Isend(
+            &nsend, 1, MPI_LONG_LONG, dest, size_tag, comm, &reqs[nreq++]);
+    }
+    MPI_Waitall(nreq, reqs, MPI_STATUSES_IGNORE);
+
+    if ((nsend > INT_MAX) || (nrecv > INT_MAX)) {
+        amrex::Abort(
+            "BuddyCheckpoint: in-memory checkpoint exceeds the maximum MPI "
+            "message size; use more ranks");
+    }
+
+    nreq = 0;
+    if (src >= 0) {
+        recvbuf.resize(nrecv);
+        MPI_Irecv(
+            recvbuf.data(), static_cast<int>(nrecv), dtype, src, data_tag,
+            comm, &reqs[nreq++]);
+    }
+    if (dest >= 0) {
+        MPI_Isend(
+            sendbuf.data(), static_cast<int>(nsend), dtype, dest, data_tag,
+            comm, &reqs[nreq++]);
+    }
+    MPI_Waitall(nreq, reqs, MPI_STATUSES_IGNORE);
+#else
+    if (src >= 0) {
+        recvbuf = sendbuf;
+    }
+#endif
+}
+
+} // namespace amr_wind
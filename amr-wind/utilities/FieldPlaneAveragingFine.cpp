@@ -214,17 +214,7 @@ void FPlaneAveragingFine<FType>::compute_averages(const IndexSelector& idxOp)
         const amrex::Real dy = geom.CellSize()[idxOp.odir1];
         const amrex::Real dz = geom.CellSize()[idxOp.odir2];
 
-        amrex::iMultiFab level_mask;
-        if (lev < finestLevel) {
-            level_mask = makeFineMask(
-                mesh.boxArray(lev), mesh.DistributionMap(lev),
-                mesh.boxArray(lev + 1), amrex::IntVect(2), 1, 0);
-        } else {
-            level_mask.define(
-                mesh.boxArray(lev), mesh.DistributionMap(lev), 1, 0,
-                amrex::MFInfo());
-            level_mask.setVal(1);
-        }
+        const auto& level_mask = m_field.repo().fine_masks().cell_mask(lev);
 
         const auto& mfab = m_field(lev);
 
@@ -402,17 +392,7 @@ void VelPlaneAveragingFine::compute_hvelmag_averages(const IndexSelector& idxOp)
         const amrex::Real dy = geom.CellSize()[idxOp.odir1];
         const amrex::Real dz = geom.CellSize()[idxOp.odir2];
 
-        amrex::iMultiFab level_mask;
-        if (lev < finestLevel) {
-            level_mask = makeFineMask(
-                mesh.boxArray(lev), mesh.DistributionMap(lev),
-                mesh.boxArray(lev + 1), amrex::IntVect(2), 1, 0);
-        } else {
-            level_mask.define(
-                mesh.boxArray(lev), mesh.DistributionMap(lev), 1, 0,
-                amrex::MFInfo());
-            level_mask.setVal(1);
-        }
+        const auto& level_mask = m_field.repo().fine_masks().cell_mask(lev);
 
         const auto& mfab = m_field(lev);
 
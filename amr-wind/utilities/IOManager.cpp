@@ -1,6 +1,7 @@
 #include <AMReX_MultiFab.H>
 #include <AMReX_REAL.H>
 #include <chrono>
+#include <cmath>
 #include <ctime>
 #include <fstream>
 
@@ -10,6 +11,7 @@
 #include "amr-wind/utilities/io_utils.H"
 #include "amr-wind/utilities/DerivedQuantity.H"
 #include "amr-wind/utilities/DerivedQtyDefs.H"
+#include "amr-wind/utilities/BuddyCheckpoint.H"
 #include "amr-wind/utilities/ncutils/nc_interface.H"
 
 #include "AMReX_ParmParse.H"
@@ -44,6 +46,26 @@ void IOManager::initialize_io()
     pp.query("check_file", m_chk_prefix);
     pp.query("restart_file", m_restart_file);
     pp.query("allow_missing_restart_fields", m_allow_missing_restart_fields);
+    pp.query("plot_max_level", m_plt_max_level);
+    pp.queryarr("plot_coarsen_ratio", m_plt_coarsen);
+    {
+        amrex::Vector<std::string> regions;
+        pp.queryarr("plot_regions", regions);
+        for (const auto& label : regions) {
+            amrex::ParmParse ppr("io." + label);
+            amrex::Vector<amrex::Real> lo, hi;
+            ppr.getarr("lo", lo);
+            ppr.getarr("hi", hi);
+            AMREX_ALWAYS_ASSERT(
+                (lo.size() == AMREX_SPACEDIM) && (hi.size() == AMREX_SPACEDIM));
+            m_plt_regions.emplace_back(lo.data(), hi.data());
+        }
+    }
+    for (const auto ratio : m_plt_coarsen) {
+        if (ratio < 1) {
+            amrex::Abort("IOManager: io.plot_coarsen_ratio must be positive");
+        }
+    }
 #ifdef AMR_WIND_USE_HDF5
     pp.query("output_hdf5_plotfile", m_output_hdf5_plotfile);
 #ifdef AMR_WIND_USE_HDF5_ZFP
@@ -122,14 +144,15 @@ void IOManager::initialize_io()
         auto& fld = repo.get_field(fname);
         m_chk_fields.emplace_back(&fld);
     }
+
+    m_buddy_chk = std::make_unique<BuddyCheckpoint>(m_sim, m_chk_fields);
+    m_buddy_chk->initialize();
 }
 
 void IOManager::write_plot_file()
 {
     BL_PROFILE("amr-wind::IOManager::write_plot_file");
 
-    amrex::Vector<int> istep(
-        m_sim.mesh().finestLevel() + 1, m_sim.time().time_index());
     const int plt_comp = m_plt_num_comp;
     const int start_comp = m_plt_num_comp - m_derived_mgr->num_comp();
     auto outfield = m_sim.repo().create_scratch_field(plt_comp);
@@ -155,16 +178,30 @@ void IOManager::write_plot_file()
 
     (*m_derived_mgr)(*outfield, start_comp);
 
+    const auto& mesh = m_sim.mesh();
+    int nout = nlevels;
+    auto out_ptrs = outfield->vec_const_ptrs();
+    amrex::Vector<amrex::Geometry> out_geom(mesh.Geom());
+    amrex::Vector<amrex::IntVect> out_ratio(mesh.refRatio());
+    amrex::Vector<amrex::MultiFab> out_mf;
+    if (subsample_plot_files()) {
+        nout = subsample_plot_data(out_ptrs, out_mf, out_geom, out_ratio);
+        out_ptrs.resize(nout);
+        for (int lev = 0; lev < nout; ++lev) {
+            out_ptrs[lev] = &out_mf[lev];
+        }
+    }
+    amrex::Vector<int> istep(nout, m_sim.time().time_index());
+
     const std::string& plt_filename =
         amrex::Concatenate(m_plt_prefix, m_sim.time().time_index());
-    const auto& mesh = m_sim.mesh();
     amrex::Print() << "Writing plot file       " << plt_filename << " at time "
                    << m_sim.time().new_time() << std::endl;
 #ifdef AMR_WIND_USE_HDF5
     if (m_output_hdf5_plotfile) {
         amrex::WriteMultiLevelPlotfileHDF5SingleDset(
-            plt_filename, nlevels, outfield->vec_const_ptrs(), m_plt_var_names,
-            mesh.Geom(), m_sim.time().new_time(), istep, mesh.refRatio()
+            plt_filename, nout, out_ptrs, m_plt_var_names, out_geom,
+            m_sim.time().new_time(), istep, out_ratio
 #ifdef AMR_WIND_USE_HDF5_ZFP
                                                              ,
             m_hdf5_compression
@@ -173,14 +210,122 @@ void IOManager::write_plot_file()
     } else {
 #endif
         amrex::WriteMultiLevelPlotfile(
-            plt_filename, nlevels, outfield->vec_const_ptrs(), m_plt_var_names,
-            mesh.Geom(), m_sim.time().new_time(), istep, mesh.refRatio());
+            plt_filename, nout, out_ptrs, m_plt_var_names, out_geom,
+            m_sim.time().new_time(), istep, out_ratio);
         write_info_file(plt_filename);
 #ifdef AMR_WIND_USE_HDF5
     }
 #endif
 }
 
+int IOManager::subsample_plot_data(
+    const amrex::Vector<const amrex::MultiFab*>& mfs,
+    amrex::Vector<amrex::MultiFab>& out_mf,
+    amrex::Vector<amrex::Geometry>& out_geom,
+    amrex::Vector<amrex::IntVect>& out_ratio) const
+{
+    BL_PROFILE("amr-wind::IOManager::subsample_plot_data");
+    const auto& mesh = m_sim.mesh();
+    int nlevels = static_cast<int>(mfs.size());
+    if (m_plt_max_level >= 0) {
+        nlevels = amrex::min(nlevels, m_plt_max_level + 1);
+    }
+
+    out_mf.clear();
+    out_mf.resize(nlevels);
+    out_geom.clear();
+    out_ratio.clear();
+    amrex::IntVect prev_crse(1);
+    for (int lev = 0; lev < nlevels; ++lev) {
+        const auto& mf = *mfs[lev];
+        const int ncomp = mf.nComp();
+        const auto& geom = mesh.Geom(lev);
+        // The last ratio applies to all the finer levels
+        const int ncrse = static_cast<int>(m_plt_coarsen.size());
+        const amrex::IntVect crse(
+            (ncrse > 0) ? m_plt_coarsen[amrex::min(lev, ncrse - 1)] : 1);
+        if (!mf.boxArray().coarsenable(crse)) {
+            amrex::Abort(
+                "IOManager: the grids on level " + std::to_string(lev) +
+                " cannot be coarsened by io.plot_coarsen_ratio");
+        }
+
+        // Average down on the ranks that own the data
+        const auto& dmap = mf.DistributionMap();
+        const amrex::BoxArray cba = amrex::coarsen(mf.boxArray(), crse);
+        amrex::MultiFab cmf(cba, dmap, ncomp, 0);
+        amrex::average_down(mf, cmf, 0, ncomp, crse);
+
+        const amrex::Geometry cgeom(
+            amrex::coarsen(geom.Domain(), crse), geom.ProbDomain(),
+            geom.Coord(), geom.isPeriodic());
+
+        // Clip to the regions of interest, keeping each box on its owner
+        amrex::BoxList bl;
+        amrex::Vector<int> pmap;
+        if (m_plt_regions.empty()) {
+            bl = cba.boxList();
+            pmap = dmap.ProcessorMap();
+        } else {
+            amrex::BoxList rbl;
+            for (const auto& rbox : m_plt_regions) {
+                amrex::IntVect lo, hi;
+                for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+                    lo[d] = static_cast<int>(std::floor(
+                        (rbox.lo(d) - cgeom.ProbLo(d)) * cgeom.InvCellSize(d)));
+                    hi[d] = static_cast<int>(std::ceil(
+                                (rbox.hi(d) - cgeom.ProbLo(d)) *
+                                cgeom.InvCellSize(d))) -
+                            1;
+                }
+                const amrex::Box rbx = amrex::Box(lo, hi) & cgeom.Domain();
+                if (rbx.ok()) {
+                    rbl.push_back(rbx);
+                }
+            }
+            // Overlapping regions must not produce overlapping grids
+            amrex::BoxArray rba(std::move(rbl));
+            rba.removeOverlap();
+
+            for (int i = 0; i < cba.size(); ++i) {
+                for (const auto& isect : rba.intersections(cba[i])) {
+                    bl.push_back(isect.second);
+                    pmap.push_back(dmap[i]);
+                }
+            }
+        }
+
+        if (bl.isEmpty()) {
+            break;
+        }
+        if (lev > 0) {
+            const amrex::IntVect rr = mesh.refRatio(lev - 1) * prev_crse;
+            for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+                if ((rr[d] % crse[d]) != 0) {
+                    amrex::Abort(
+                        "IOManager: io.plot_coarsen_ratio is incompatible "
+                        "with the refinement ratio");
+                }
+            }
+            out_ratio.push_back(rr / crse);
+        }
+        prev_crse = crse;
+
+        out_mf[lev].define(
+            amrex::BoxArray(std::move(bl)),
+            amrex::DistributionMapping(std::move(pmap)), ncomp, 0);
+        out_mf[lev].ParallelCopy(cmf, 0, 0, ncomp);
+        out_geom.push_back(cgeom);
+    }
+
+    const int nout = static_cast<int>(out_geom.size());
+    if (nout == 0) {
+        amrex::Abort("IOManager: the plot regions do not intersect the mesh");
+    }
+    out_mf.resize(nout);
+    return nout;
+}
+
 void IOManager::write_checkpoint_file(const int start_level)
 {
     BL_PROFILE("amr-wind::IOManager::write_checkpoint_file");
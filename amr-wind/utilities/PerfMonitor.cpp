@@ -0,0 +1,283 @@
+#include "amr-wind/utilities/PerfMonitor.H"
+#include "amr-wind/CFDSim.H"
+#include "amr-wind/utilities/console_io.H"
+
+#include "AMReX_ParmParse.H"
+#include "AMReX_ParallelDescriptor.H"
+#include "AMReX_Gpu.H"
+
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+
+namespace amr_wind {
+
+namespace {
+
+//! Identifier at the start of the binary output files
+constexpr char binary_magic[] = "AMRWPERF";
+
+//! Version of the binary output format
+constexpr std::int32_t binary_version = 2;
+
+//! Number of sample values stored per timestep for the phase times
+constexpr int num_times = PerfMonitor::num_phases + 1;
+
+//! Number of sample values stored per timestep for the counters
+constexpr int num_counts =
+    PerfMonitor::num_counters * (PerfMonitor::num_phases + 1);
+
+} // namespace
+
+PerfMonitor::PerfMonitor(CFDSim& sim) : m_sim(sim) {}
+
+void PerfMonitor::initialize()
+{
+    amrex::ParmParse pp("io");
+    pp.query("perf_monitor", m_enabled);
+    if (!m_enabled) {
+        return;
+    }
+
+    pp.query("perf_monitor_format", m_out_fmt);
+    pp.query("perf_monitor_flush_interval", m_flush_interval);
+    pp.query("perf_monitor_sync_device", m_sync_device);
+    if ((m_out_fmt != "csv") && (m_out_fmt != "binary")) {
+        amrex::Abort(
+            "PerfMonitor: invalid output format " + m_out_fmt +
+            "; valid options are csv and binary");
+    }
+    m_out_file = (m_out_fmt == "csv") ? "perf_monitor.csv" : "perf_monitor.bin";
+    pp.query("perf_monitor_file", m_out_file);
+    m_flush_interval = amrex::max(m_flush_interval, 1);
+
+    const int nbuf = m_flush_interval;
+    m_time_index.reserve(nbuf);
+    m_sim_time.reserve(nbuf);
+    m_dt.reserve(nbuf);
+    m_time_buffer.reserve(nbuf * num_times);
+    m_count_buffer.reserve(nbuf * num_counts);
+
+    if (!amrex::ParallelDescriptor::IOProcessor()) {
+        return;
+    }
+
+    const auto names = column_names();
+    if (m_out_fmt == "csv") {
+        std::ofstream fh(m_out_file, std::ios::out | std::ios::trunc);
+        for (int i = 0; i < static_cast<int>(names.size()); ++i) {
+            fh << ((i > 0) ? "," : "") << names[i];
+        }
+        fh << std::endl;
+    } else {
+        std::ofstream fh(
+            m_out_file, std::ios::out | std::ios::trunc | std::ios::binary);
+        const auto ncols = static_cast<std::int32_t>(names.size());
+        fh.write(binary_magic, sizeof(binary_magic) - 1);
+        fh.write(
+            reinterpret_cast<const char*>(&binary_version),
+            sizeof(binary_version));
+        fh.write(reinterpret_cast<const char*>(&ncols), sizeof(ncols));
+        for (const auto& name : names) {
+            fh.write(name.c_str(), name.size() + 1);
+        }
+    }
+}
+
+amrex::Vector<std::string> PerfMonitor::column_names()
+{
+    const amrex::Vector<std::string> phases{
+        "regrid", "pre_advance", "advance", "post_advance", "output"};
+    const amrex::Vector<std::string> counters{
+        "mlmg_iterations", "halo_exchanges", "halo_bytes", "halo_messages",
+        "particles"};
+
+    amrex::Vector<std::string> names{"time_index", "time", "dt"};
+    names.insert(names.end(), phases.begin(), phases.end());
+    names.emplace_back("step_total");
+    names.insert(names.end(), counters.begin(), counters.end());
+    for (const auto& phase : phases) {
+        for (const auto& counter : counters) {
+            names.push_back(phase + "_" + counter);
+        }
+    }
+    return names;
+}
+
+PerfMonitor::CounterArray PerfMonitor::cumulative_counters() const
+{
+    CounterArray vals{{0}};
+    // The MLMG iterations and the exchanges are the same on all ranks, so
+    // they are only counted on one rank for the sum across ranks
+    const auto& stats = m_sim.repo().fillpatch_stats();
+    if (amrex::ParallelDescriptor::IOProcessor()) {
+        vals[static_cast<int>(Counter::MLMGIterations)] =
+            io::total_mlmg_iterations();
+        vals[static_cast<int>(Counter::HaloExchanges)] = stats.num_exchanges;
+    }
+    vals[static_cast<int>(Counter::HaloBytes)] = stats.num_bytes;
+    vals[static_cast<int>(Counter::HaloMessages)] = stats.num_messages;
+    return vals;
+}
+
+void PerfMonitor::begin_step()
+{
+    if (!m_enabled) {
+        return;
+    }
+
+    m_step_counter_start = cumulative_counters();
+    m_phase_time.fill(0.0);
+    m_counters.fill(0);
+    for (auto& pcounts : m_phase_counters) {
+        pcounts.fill(0);
+    }
+    m_active_phases = 0;
+    m_step_start = amrex::ParallelDescriptor::second();
+}
+
+void PerfMonitor::end_step()
+{
+    if (!m_enabled) {
+        return;
+    }
+
+    if (m_sync_device) {
+        amrex::Gpu::streamSynchronize();
+    }
+    const amrex::Real step_time =
+        amrex::ParallelDescriptor::second() - m_step_start;
+
+    const auto counters = cumulative_counters();
+    for (int i = 0; i < num_counters; ++i) {
+        m_counters[i] += counters[i] - m_step_counter_start[i];
+    }
+
+    const auto& time = m_sim.time();
+    m_time_index.push_back(time.time_index());
+    m_sim_time.push_back(time.new_time());
+    m_dt.push_back(time.deltaT());
+    m_time_buffer.insert(
+        m_time_buffer.end(), m_phase_time.begin(), m_phase_time.end());
+    m_time_buffer.push_back(step_time);
+    m_count_buffer.insert(
+        m_count_buffer.end(), m_counters.begin(), m_counters.end());
+    for (const auto& pcounts : m_phase_counters) {
+        m_count_buffer.insert(
+            m_count_buffer.end(), pcounts.begin(), pcounts.end());
+    }
+
+    if (num_buffered() >= m_flush_interval) {
+        flush();
+    }
+}
+
+void PerfMonitor::start(const Phase phase)
+{
+    if (!m_enabled) {
+        return;
+    }
+    if (m_sync_device) {
+        amrex::Gpu::streamSynchronize();
+    }
+    const int idx = static_cast<int>(phase);
+    m_phase_counter_start[idx] = cumulative_counters();
+    m_active_phases |= (1U << idx);
+    m_phase_start[idx] = amrex::ParallelDescriptor::second();
+}
+
+void PerfMonitor::stop(const Phase phase)
+{
+    if (!m_enabled) {
+        return;
+    }
+    if (m_sync_device) {
+        amrex::Gpu::streamSynchronize();
+    }
+    const int idx = static_cast<int>(phase);
+    m_phase_time[idx] +=
+        amrex::ParallelDescriptor::second() - m_phase_start[idx];
+
+    const auto counters = cumulative_counters();
+    for (int i = 0; i < num_counters; ++i) {
+        m_phase_counters[idx][i] += counters[i] - m_phase_counter_start[idx][i];
+    }
+    m_active_phases &= ~(1U << idx);
+}
+
+void PerfMonitor::flush()
+{
+    if (!m_enabled || (num_buffered() == 0)) {
+        return;
+    }
+
+    BL_PROFILE("amr-wind::PerfMonitor::flush");
+    // One reduction of each kind for all the buffered timesteps
+    const int ioproc = amrex::ParallelDescriptor::IOProcessorNumber();
+    amrex::ParallelDescriptor::ReduceRealMax(
+        m_time_buffer.data(), static_cast<int>(m_time_buffer.size()), ioproc);
+    amrex::ParallelDescriptor::ReduceLongSum(
+        m_count_buffer.data(), static_cast<int>(m_count_buffer.size()),
+        ioproc);
+
+    if (amrex::ParallelDescriptor::IOProcessor()) {
+        if (m_out_fmt == "csv") {
+            write_csv(m_time_buffer, m_count_buffer);
+        } else {
+            write_binary(m_time_buffer, m_count_buffer);
+        }
+    }
+
+    m_time_index.clear();
+    m_sim_time.clear();
+    m_dt.clear();
+    m_time_buffer.clear();
+    m_count_buffer.clear();
+}
+
+void PerfMonitor::write_csv(
+    const amrex::Vector<amrex::Real>& times,
+    const amrex::Vector<amrex::Long>& counts) const
+{
+    std::ofstream fh(m_out_file, std::ios::out | std::ios::app);
+    fh << std::setprecision(6);
+    for (int n = 0; n < num_buffered(); ++n) {
+        fh << m_time_index[n] << "," << std::scientific << m_sim_time[n] << ","
+           << m_dt[n];
+        for (int i = 0; i < num_times; ++i) {
+            fh << "," << times[n * num_times + i];
+        }
+        fh << std::defaultfloat;
+        for (int i = 0; i < num_counts; ++i) {
+            fh << "," << counts[n * num_counts + i];
+        }
+        fh << "\n";
+    }
+}
+
+void PerfMonitor::write_binary(
+    const amrex::Vector<amrex::Real>& times,
+    const amrex::Vector<amrex::Long>& counts) const
+{
+    // Each record stores all the columns as 64-bit floating point values
+    std::ofstream fh(
+        m_out_file, std::ios::out | std::ios::app | std::ios::binary);
+    amrex::Vector<double> record(3 + num_times + num_counts);
+    for (int n = 0; n < num_buffered(); ++n) {
+        int idx = 0;
+        record[idx++] = static_cast<double>(m_time_index[n]);
+        record[idx++] = static_cast<double>(m_sim_time[n]);
+        record[idx++] = static_cast<double>(m_dt[n]);
+        for (int i = 0; i < num_times; ++i) {
+            record[idx++] = static_cast<double>(times[n * num_times + i]);
+        }
+        for (int i = 0; i < num_counts; ++i) {
+            record[idx++] = static_cast<double>(counts[n * num_counts + i]);
+        }
+        fh.write(
+            reinterpret_cast<const char*>(record.data()),
+            static_cast<std::streamsize>(record.size() * sizeof(double)));
+    }
+}
+
+} // namespace amr_wind
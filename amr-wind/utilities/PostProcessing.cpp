@@ -1,6 +1,8 @@
 #include "amr-wind/utilities/PostProcessing.H"
 #include "amr-wind/CFDSim.H"
 #include "amr-wind/utilities/averaging/TimeAveraging.H"
+#include "amr-wind/utilities/ReductionEngine.H"
+#include "amr-wind/utilities/TaskScheduler.H"
 
 #include "AMReX_ParmParse.H"
 
@@ -26,13 +28,25 @@ void perform_checks(
 }
 } // namespace
 
-PostProcessManager::PostProcessManager(CFDSim& sim) : m_sim(sim) {}
+PostProcessManager::PostProcessManager(CFDSim& sim)
+    : m_sim(sim)
+    , m_reductions(new ReductionEngine(sim))
+    , m_tasks(new TaskScheduler(0))
+{}
+
+PostProcessManager::~PostProcessManager() = default;
 
 void PostProcessManager::pre_init_actions()
 {
     amrex::Vector<std::string> pnames;
     amrex::ParmParse pp("incflo");
     pp.queryarr("post_processing", pnames);
+
+    int num_threads = 0;
+    pp.query("post_processing_threads", num_threads);
+    if (num_threads > 0) {
+        m_tasks = std::make_unique<TaskScheduler>(num_threads);
+    }
     std::set<std::string> registered_types;
 
     for (const auto& label : pnames) {
@@ -51,6 +65,7 @@ void PostProcessManager::pre_init_actions()
 
 void PostProcessManager::post_init_actions()
 {
+    m_reductions->invalidate();
     for (auto& post : m_post) {
         post->initialize();
         post->post_advance_work();
@@ -59,11 +74,24 @@ void PostProcessManager::post_init_actions()
 
 void PostProcessManager::post_advance_work()
 {
+    wait_for_tasks();
+    m_reductions->invalidate();
     for (auto& post : m_post) {
         post->post_advance_work();
     }
 }
 
+void PostProcessManager::wait_for_tasks()
+{
+    BL_PROFILE("amr-wind::PostProcessManager::wait_for_tasks");
+    try {
+        m_tasks->wait();
+    } catch (const std::exception& err) {
+        amrex::Abort(
+            std::string("PostProcessing: output task failed: ") + err.what());
+    }
+}
+
 void PostProcessManager::post_regrid_actions()
 {
     for (auto& post : m_post) {
@@ -0,0 +1,110 @@
+#include "amr-wind/utilities/ReductionEngine.H"
+#include "amr-wind/CFDSim.H"
+
+namespace amr_wind {
+
+ReductionEngine::ReductionEngine(CFDSim& sim) : m_sim(sim) {}
+
+ReductionEngine::~ReductionEngine() = default;
+
+amrex::Real ReductionEngine::value(const int qid)
+{
+    const auto& time = m_sim.time();
+    if ((time.time_index() != m_time_index) || (time.new_time() != m_time)) {
+        invalidate();
+        m_time_index = time.time_index();
+        m_time = time.new_time();
+    }
+
+    if (!m_qtys[qid]->evaluated) {
+        sweep(qid);
+    }
+    return m_qtys[qid]->result;
+}
+
+void ReductionEngine::invalidate()
+{
+    for (auto& qty : m_qtys) {
+        qty->evaluated = false;
+    }
+}
+
+void ReductionEngine::sweep(const int qid)
+{
+    BL_PROFILE("amr-wind::ReductionEngine::sweep");
+    const int tidx = m_sim.time().time_index();
+
+    amrex::Vector<reduction_impl::QuantityBase*> qtys;
+    for (int iq = 0; iq < static_cast<int>(m_qtys.size()); ++iq) {
+        auto& qty = *m_qtys[iq];
+        if (qty.evaluated) {
+            continue;
+        }
+        if ((iq == qid) || ((qty.out_freq > 0) && (tidx % qty.out_freq == 0))) {
+            qtys.push_back(&qty);
+        }
+    }
+
+    for (auto* qty : qtys) {
+        if (qty->prepare) {
+            qty->prepare();
+        }
+        qty->reset();
+    }
+
+    auto& fine_masks = m_sim.repo().fine_masks();
+    const int nlevels = m_sim.repo().num_active_levels();
+    for (int lev = 0; lev < nlevels; ++lev) {
+        const auto& mask = fine_masks.cell_mask(lev);
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+        for (amrex::MFIter mfi(mask, amrex::TilingIfNotGPU()); mfi.isValid();
+             ++mfi) {
+            const auto& bx = mfi.tilebox();
+            const auto& mask_arr = mask.const_array(mfi);
+            for (auto* qty : qtys) {
+                if (qty->nodal == amrex::IntVect::TheZeroVector()) {
+                    qty->eval(lev, mfi, bx, mask_arr);
+                } else {
+                    qty->eval(lev, mfi, mfi.tilebox(qty->nodal), mask_arr);
+                }
+            }
+        }
+    }
+
+    // Combine the results from all ranks with one reduction per operation
+    amrex::Array<amrex::Vector<amrex::Real>, 3> vals;
+    for (auto* qty : qtys) {
+        vals[qty->op_index].push_back(qty->local_value());
+    }
+    auto& sums = vals[static_cast<int>(ReduceType::Sum)];
+    auto& maxs = vals[static_cast<int>(ReduceType::Max)];
+    auto& mins = vals[static_cast<int>(ReduceType::Min)];
+    if (!sums.empty()) {
+        amrex::ParallelDescriptor::ReduceRealSum(
+            sums.data(), static_cast<int>(sums.size()));
+    }
+    if (!maxs.empty()) {
+        amrex::ParallelDescriptor::ReduceRealMax(
+            maxs.data(), static_cast<int>(maxs.size()));
+    }
+    if (!mins.empty()) {
+        amrex::ParallelDescriptor::ReduceRealMin(
+            mins.data(), static_cast<int>(mins.size()));
+    }
+
+    amrex::Array<int, 3> idx{{0, 0, 0}};
+    for (auto* qty : qtys) {
+        qty->result = vals[qty->op_index][idx[qty->op_index]++];
+        qty->evaluated = true;
+    }
+    ++m_num_sweeps;
+}
+
+int ReductionEngine::num_mask_builds() const
+{
+    return m_sim.repo().fine_masks().num_builds();
+}
+
+} // namespace amr_wind
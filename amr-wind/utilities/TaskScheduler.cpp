@@ -0,0 +1,86 @@
+#include "amr-wind/utilities/TaskScheduler.H"
+
+namespace amr_wind {
+
+TaskScheduler::TaskScheduler(const int num_threads)
+{
+    m_workers.reserve(num_threads);
+    for (int i = 0; i < num_threads; ++i) {
+        m_workers.emplace_back([this]() { worker_loop(); });
+    }
+}
+
+TaskScheduler::~TaskScheduler()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_work_cv.notify_all();
+    for (auto& worker : m_workers) {
+        worker.join();
+    }
+}
+
+void TaskScheduler::submit(Task task)
+{
+    if (m_workers.empty()) {
+        task();
+        return;
+    }
+
+    ++m_num_pending;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_queue.push_back(std::move(task));
+    }
+    m_work_cv.notify_one();
+}
+
+void TaskScheduler::wait()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_done_cv.wait(lock, [this]() { return m_num_pending.load() == 0; });
+    if (m_error) {
+        auto err = m_error;
+        m_error = nullptr;
+        std::rethrow_exception(err);
+    }
+}
+
+void TaskScheduler::worker_loop()
+{
+    while (true) {
+        Task task;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_work_cv.wait(
+                lock, [this]() { return m_stop || !m_queue.empty(); });
+            if (m_queue.empty()) {
+                // Only reached when stopping with no tasks left
+                return;
+            }
+            task = std::move(m_queue.front());
+            m_queue.pop_front();
+        }
+        run(task);
+    }
+}
+
+void TaskScheduler::run(Task& task)
+{
+    try {
+        task();
+    } catch (...) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_error) {
+            m_error = std::current_exception();
+        }
+    }
+    if (--m_num_pending == 0) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_done_cv.notify_all();
+    }
+}
+
+} // namespace amr_wind
@@ -42,6 +42,12 @@ void AscentPostProcess::initialize()
         }
 
         auto& fld = repo.get_field(fname);
+        if (fld.field_location() != FieldLoc::CELL) {
+            amrex::Print() << "WARNING: Ascent: Only cell-centered fields are "
+                              "supported, ignoring field: "
+                           << fname << std::endl;
+            continue;
+        }
         m_fields.emplace_back(&fld);
         ioutils::add_var_names(m_var_names, fld.name(), fld.num_comp());
     }
@@ -55,38 +61,14 @@ void AscentPostProcess::post_advance_work()
     const int tidx = time.time_index();
     // Output only on given frequency
     if (!(tidx % m_out_freq == 0)) return;
-
-    amrex::Vector<int> istep(
-        m_sim.mesh().finestLevel() + 1, m_sim.time().time_index());
-
-    int plt_num_comp = 0;
-    for (auto* fld : m_fields) {
-        plt_num_comp += fld->num_comp();
-    }
-
-    auto outfield = m_sim.repo().create_scratch_field(plt_num_comp);
-
-    const int nlevels = m_sim.repo().num_active_levels();
-
-    for (int lev = 0; lev < nlevels; ++lev) {
-        int icomp = 0;
-        auto& mf = (*outfield)(lev);
-
-        for (auto* fld : m_fields) {
-            amrex::MultiFab::Copy(
-                mf, (*fld)(lev), 0, icomp, fld->num_comp(), 0);
-            icomp += fld->num_comp();
-        }
-    }
-
-    const auto& mesh = m_sim.mesh();
+    if (m_fields.empty()) return;
 
     amrex::Print() << "Calling Ascent at time " << m_sim.time().new_time()
                    << std::endl;
-    conduit::Node bp_mesh;
-    amrex::MultiLevelToBlueprint(
-        nlevels, outfield->vec_const_ptrs(), m_var_names, mesh.Geom(),
-        m_sim.time().new_time(), istep, mesh.refRatio(), bp_mesh);
+    if (!m_bp_mesh) {
+        build_blueprint_mesh();
+    }
+    update_blueprint_fields();
 
     ascent::Ascent ascent;
     conduit::Node open_opts;
@@ -96,14 +78,9 @@ void AscentPostProcess::post_advance_work()
         MPI_Comm_c2f(amrex::ParallelDescriptor::Communicator());
 #endif
     ascent.open(open_opts);
-    conduit::Node verify_info;
-    if (!conduit::blueprint::mesh::verify(bp_mesh, verify_info)) {
-        ASCENT_INFO("Error: Mesh Blueprint Verify Failed!");
-        verify_info.print();
-    }
 
     conduit::Node actions;
-    ascent.publish(bp_mesh);
+    ascent.publish(*m_bp_mesh);
 
     ascent.execute(actions);
 
@@ -112,7 +89,129 @@ void AscentPostProcess::post_advance_work()
 
 void AscentPostProcess::post_regrid_actions()
 {
-    // nothing to do here
+    // The blueprint mesh is rebuilt for the new grids at the next output
+    m_domains.clear();
+    m_bp_mesh.reset();
+    m_staging.reset();
+}
+
+bool AscentPostProcess::is_staged(const Field& fld) const
+{
+    return fld.num_grow() != m_fields[0]->num_grow();
+}
+
+void AscentPostProcess::build_blueprint_mesh()
+{
+    BL_PROFILE("amr-wind::AscentPostProcess::build_blueprint_mesh");
+
+    const auto& mesh = m_sim.mesh();
+    const int nlevels = m_sim.repo().num_active_levels();
+
+    // The mesh topology includes the ghost cells of the first field. The
+    // other fields with the same ghost cells share it without a copy.
+    const auto& base = *m_fields[0];
+    int nstaged = 0;
+    for (auto* fld : m_fields) {
+        if (is_staged(*fld)) {
+            nstaged += fld->num_comp();
+        }
+    }
+    if (nstaged > 0) {
+        const auto& ngrow = base.num_grow();
+        AMREX_ALWAYS_ASSERT(ngrow == amrex::IntVect(ngrow.max()));
+        m_staging = m_sim.repo().create_scratch_field(nstaged, ngrow.max());
+    }
+
+    amrex::Vector<const amrex::MultiFab*> base_mfs(nlevels);
+    for (int lev = 0; lev < nlevels; ++lev) {
+        base_mfs[lev] = &base(lev);
+    }
+    const amrex::Vector<std::string> base_names(
+        m_var_names.begin(), m_var_names.begin() + base.num_comp());
+    amrex::Vector<int> istep(nlevels, m_sim.time().time_index());
+
+    m_bp_mesh = std::make_unique<conduit::Node>();
+    amrex::MultiLevelToBlueprint(
+        nlevels, base_mfs, base_names, mesh.Geom(), m_sim.time().new_time(),
+        istep, mesh.refRatio(), *m_bp_mesh);
+
+    // The domains are created in the order of the levels and boxes
+    m_domains.clear();
+    for (conduit::index_t i = 0; i < m_bp_mesh->number_of_children(); ++i) {
+        m_domains.push_back(&m_bp_mesh->child(i));
+    }
+
+    // Metadata of the other fields, the data is set at every output
+    for (auto* dom : m_domains) {
+        auto& fields = (*dom)["fields"];
+        const std::string topo = fields[base_names[0]]["topology"].as_string();
+        for (const auto& name : m_var_names) {
+            auto& fnode = fields[name];
+            fnode["association"] = "element";
+            fnode["topology"] = topo;
+        }
+    }
+
+    conduit::Node verify_info;
+    if (!conduit::blueprint::mesh::verify(*m_bp_mesh, verify_info)) {
+        ASCENT_INFO("Error: Mesh Blueprint Verify Failed!");
+        verify_info.print();
+    }
+}
+
+void AscentPostProcess::update_blueprint_fields()
+{
+    BL_PROFILE("amr-wind::AscentPostProcess::update_blueprint_fields");
+
+    const auto& time = m_sim.time();
+    const int nlevels = m_sim.repo().num_active_levels();
+
+    if (m_staging) {
+        for (int lev = 0; lev < nlevels; ++lev) {
+            int icomp = 0;
+            for (auto* fld : m_fields) {
+                if (!is_staged(*fld)) {
+                    continue;
+                }
+                amrex::MultiFab::Copy(
+                    (*m_staging)(lev), (*fld)(lev), 0, icomp, fld->num_comp(),
+                    0);
+                icomp += fld->num_comp();
+            }
+        }
+    }
+
+    // The field data can be reallocated between outputs, so the views are
+    // updated every time
+    int idom = 0;
+    for (int lev = 0; lev < nlevels; ++lev) {
+        for (amrex::MFIter mfi((*m_fields[0])(lev)); mfi.isValid(); ++mfi) {
+            AMREX_ALWAYS_ASSERT(idom < static_cast<int>(m_domains.size()));
+            auto& dom = *m_domains[idom++];
+            dom["state/cycle"] = time.time_index();
+            dom["state/time"] = time.new_time();
+
+            auto& fields = dom["fields"];
+            int ivar = 0;
+            int istaged = 0;
+            for (auto* fld : m_fields) {
+                const bool staged = is_staged(*fld);
+                const auto& fab =
+                    staged ? (*m_staging)(lev)[mfi] : (*fld)(lev)[mfi];
+                const int scomp = staged ? istaged : 0;
+                const auto npts = fab.box().numPts();
+                for (int n = 0; n < fld->num_comp(); ++n) {
+                    fields[m_var_names[ivar++]]["values"].set_external(
+                        const_cast<amrex::Real*>(fab.dataPtr(scomp + n)),
+                        npts);
+                }
+                if (staged) {
+                    istaged += fld->num_comp();
+                }
+            }
+        }
+    }
+    AMREX_ALWAYS_ASSERT(idom == static_cast<int>(m_domains.size()));
 }
 
 } // namespace ascent_int
@@ -32,6 +32,8 @@ namespace amr_wind::io {
 namespace {
 const std::string dbl_line = std::string(78, '=') + "\n";
 const std::string dash_line = "\n" + std::string(78, '-') + "\n";
+
+amrex::Long mlmg_iterations = 0;
 } // namespace
 
 void print_usage(MPI_Comm comm, std::ostream& out)
@@ -138,6 +140,12 @@ void print_banner(MPI_Comm comm, std::ostream& out)
         << "ON    (Num. threads = " << omp_get_max_threads() << ")" << std::endl
 #else
         << "OFF" << std::endl
+#endif
+        << "  Spec. kernels    :: "
+#ifdef AMR_WIND_USE_SPECIALIZED_KERNELS
+        << "ON" << std::endl
+#else
+        << "OFF" << std::endl
 #endif
         << std::endl;
 
@@ -166,6 +174,7 @@ void print_mlmg_header(const std::string& key)
 
 void print_mlmg_info(const std::string& solve_name, const amrex::MLMG& mlmg)
 {
+    mlmg_iterations += mlmg.getNumIters();
     const int name_width = 26;
     amrex::Print() << "  " << std::setw(name_width) << std::left << solve_name
                    << std::setw(6) << std::right << mlmg.getNumIters()
@@ -174,6 +183,8 @@ void print_mlmg_info(const std::string& solve_name, const amrex::MLMG& mlmg)
                    << std::endl;
 }
 
+amrex::Long total_mlmg_iterations() { return mlmg_iterations; }
+
 void print_tpls(std::ostream& out)
 {
     amrex::Vector<std::string> tpls;
@@ -1,4 +1,5 @@
 #include <cstdio>
+#include <mutex>
 
 #include "amr-wind/utilities/ncutils/nc_interface.H"
 
@@ -10,7 +11,26 @@ namespace ncutils {
 
 namespace {
 
-char recname[NC_MAX_NAME + 1];
+//! Serializes the calls to the NetCDF library across threads
+std::mutex& nc_mutex()
+{
+    static std::mutex mtx;
+    return mtx;
+}
+
+/** Call a NetCDF library function while holding the library lock
+ *
+ *  The NetCDF library is not thread-safe. The lock is only held for the
+ *  duration of a single call, so that threads accessing different files
+ *  interleave their calls instead of waiting for each other's files to be
+ *  closed.
+ */
+template <typename Func, typename... Args>
+int nc_call(Func func, Args... args)
+{
+    std::lock_guard<std::mutex> lock(nc_mutex());
+    return func(args...);
+}
 
 void check_nc_error(int ierr)
 {
@@ -23,27 +43,29 @@ void check_nc_error(int ierr)
 
 std::string NCDim::name() const
 {
-    check_nc_error(nc_inq_dimname(ncid, dimid, recname));
+    char recname[NC_MAX_NAME + 1];
+    check_nc_error(nc_call(nc_inq_dimname, ncid, dimid, recname));
     return std::string(recname);
 }
 
 size_t NCDim::len() const
 {
     size_t dlen;
-    check_nc_error(nc_inq_dimlen(ncid, dimid, &dlen));
+    check_nc_error(nc_call(nc_inq_dimlen, ncid, dimid, &dlen));
     return dlen;
 }
 
 std::string NCVar::name() const
 {
-    check_nc_error(nc_inq_varname(ncid, varid, recname));
+    char recname[NC_MAX_NAME + 1];
+    check_nc_error(nc_call(nc_inq_varname, ncid, varid, recname));
     return std::string(recname);
 }
 
 int NCVar::ndim() const
 {
     int ndims;
-    check_nc_error(nc_inq_varndims(ncid, varid, &ndims));
+    check_nc_error(nc_call(nc_inq_varndims, ncid, varid, &ndims));
     return ndims;
 }
 
@@ -54,27 +76,27 @@ std::vector<size_t> NCVar::shape() const
     std::vector<size_t> vshape(ndims);
 
     for (int i = 0; i < ndims; ++i)
-        check_nc_error(nc_inq_vardimid(ncid, varid, dimids.data()));
+        check_nc_error(nc_call(nc_inq_vardimid, ncid, varid, dimids.data()));
 
     for (int i = 0; i < ndims; ++i)
-        check_nc_error(nc_inq_dimlen(ncid, dimids[i], &vshape[i]));
+        check_nc_error(nc_call(nc_inq_dimlen, ncid, dimids[i], &vshape[i]));
 
     return vshape;
 }
 
 void NCVar::put(const double* ptr) const
 {
-    check_nc_error(nc_put_var_double(ncid, varid, ptr));
+    check_nc_error(nc_call(nc_put_var_double, ncid, varid, ptr));
 }
 
 void NCVar::put(const float* ptr) const
 {
-    check_nc_error(nc_put_var_float(ncid, varid, ptr));
+    check_nc_error(nc_call(nc_put_var_float, ncid, varid, ptr));
 }
 
 void NCVar::put(const int* ptr) const
 {
-    check_nc_error(nc_put_var_int(ncid, varid, ptr));
+    check_nc_error(nc_call(nc_put_var_int, ncid, varid, ptr));
 }
 
 void NCVar::put(
@@ -82,8 +104,8 @@ void NCVar::put(
     const std::vector<size_t>& start,
     const std::vector<size_t>& count) const
 {
-    check_nc_error(
-        nc_put_vara_double(ncid, varid, start.data(), count.data(), dptr));
+    check_nc_error(nc_call(
+        nc_put_vara_double, ncid, varid, start.data(), count.data(), dptr));
 }
 
 void NCVar::put(
@@ -92,8 +114,9 @@ void NCVar::put(
     const std::vector<size_t>& count,
     const std::vector<ptrdiff_t>& stride) const
 {
-    check_nc_error(nc_put_vars_double(
-        ncid, varid, start.data(), count.data(), stride.data(), dptr));
+    check_nc_error(nc_call(
+        nc_put_vars_double, ncid, varid, start.data(), count.data(),
+        stride.data(), dptr));
 }
 
 void NCVar::put(
@@ -101,8 +124,8 @@ void NCVar::put(
     const std::vector<size_t>& start,
     const std::vector<size_t>& count) const
 {
-    check_nc_error(
-        nc_put_vara_float(ncid, varid, start.data(), count.data(), dptr));
+    check_nc_error(nc_call(
+        nc_put_vara_float, ncid, varid, start.data(), count.data(), dptr));
 }
 
 void NCVar::put(
@@ -111,8 +134,9 @@ void NCVar::put(
     const std::vector<size_t>& count,
     const std::vector<ptrdiff_t>& stride) const
 {
-    check_nc_error(nc_put_vars_float(
-        ncid, varid, start.data(), count.data(), stride.data(), dptr));
+    check_nc_error(nc_call(
+        nc_put_vars_float, ncid, varid, start.data(), count.data(),
+        stride.data(), dptr));
 }
 
 void NCVar::put(
@@ -120,8 +144,8 @@ void NCVar::put(
     const std::vector<size_t>& start,
     const std::vector<size_t>& count) const
 {
-    check_nc_error(
-        nc_put_vara_int(ncid, varid, start.data(), count.data(), dptr));
+    check_nc_error(nc_call(
+        nc_put_vara_int, ncid, varid, start.data(), count.data(), dptr));
 }
 
 void NCVar::put(
@@ -130,23 +154,24 @@ void NCVar::put(
     const std::vector<size_t>& count,
     const std::vector<ptrdiff_t>& stride) const
 {
-    check_nc_error(nc_put_vars_int(
-        ncid, varid, start.data(), count.data(), stride.data(), dptr));
+    check_nc_error(nc_call(
+        nc_put_vars_int, ncid, varid, start.data(), count.data(), stride.data(),
+        dptr));
 }
 
 void NCVar::get(double* ptr) const
 {
-    check_nc_error(nc_get_var_double(ncid, varid, ptr));
+    check_nc_error(nc_call(nc_get_var_double, ncid, varid, ptr));
 }
 
 void NCVar::get(float* ptr) const
 {
-    check_nc_error(nc_get_var_float(ncid, varid, ptr));
+    check_nc_error(nc_call(nc_get_var_float, ncid, varid, ptr));
 }
 
 void NCVar::get(int* ptr) const
 {
-    check_nc_error(nc_get_var_int(ncid, varid, ptr));
+    check_nc_error(nc_call(nc_get_var_int, ncid, varid, ptr));
 }
 
 void NCVar::get(
@@ -154,8 +179,8 @@ void NCVar::get(
     const std::vector<size_t>& start,
     const std::vector<size_t>& count) const
 {
-    check_nc_error(
-        nc_get_vara_double(ncid, varid, start.data(), count.data(), dptr));
+    check_nc_error(nc_call(
+        nc_get_vara_double, ncid, varid, start.data(), count.data(), dptr));
 }
 
 void NCVar::get(
@@ -164,8 +189,9 @@ void NCVar::get(
     const std::vector<size_t>& count,
     const std::vector<ptrdiff_t>& stride) const
 {
-    check_nc_error(nc_get_vars_double(
-        ncid, varid, start.data(), count.data(), stride.data(), dptr));
+    check_nc_error(nc_call(
+        nc_get_vars_double, ncid, varid, start.data(), count.data(),
+        stride.data(), dptr));
 }
 
 void NCVar::get(
@@ -173,8 +199,8 @@ void NCVar::get(
     const std::vector<size_t>& start,
     const std::vector<size_t>& count) const
 {
-    check_nc_error(
-        nc_get_vara_float(ncid, varid, start.data(), count.data(), dptr));
+    check_nc_error(nc_call(
+        nc_get_vara_float, ncid, varid, start.data(), count.data(), dptr));
 }
 
 void NCVar::get(
@@ -183,8 +209,9 @@ void NCVar::get(
     const std::vector<size_t>& count,
     const std::vector<ptrdiff_t>& stride) const
 {
-    check_nc_error(nc_get_vars_float(
-        ncid, varid, start.data(), count.data(), stride.data(), dptr));
+    check_nc_error(nc_call(
+        nc_get_vars_float, ncid, varid, start.data(), count.data(),
+        stride.data(), dptr));
 }
 
 void NCVar::get(
@@ -192,8 +219,8 @@ void NCVar::get(
     const std::vector<size_t>& start,
     const std::vector<size_t>& count) const
 {
-    check_nc_error(
-        nc_get_vara_int(ncid, varid, start.data(), count.data(), dptr));
+    check_nc_error(nc_call(
+        nc_get_vara_int, ncid, varid, start.data(), count.data(), dptr));
 }
 
 void NCVar::get(
@@ -202,91 +229,99 @@ void NCVar::get(
     const std::vector<size_t>& count,
     const std::vector<ptrdiff_t>& stride) const
 {
-    check_nc_error(nc_get_vars_int(
-        ncid, varid, start.data(), count.data(), stride.data(), dptr));
+    check_nc_error(nc_call(
+        nc_get_vars_int, ncid, varid, start.data(), count.data(), stride.data(),
+        dptr));
 }
 
 bool NCVar::has_attr(const std::string& name) const
 {
     int ierr;
     size_t lenp;
-    ierr = nc_inq_att(ncid, varid, name.data(), NULL, &lenp);
+    ierr = nc_call(nc_inq_att, ncid, varid, name.data(), nullptr, &lenp);
     return (ierr == NC_NOERR);
 }
 
 void NCVar::put_attr(const std::string& name, const std::string& value) const
 {
-    check_nc_error(
-        nc_put_att_text(ncid, varid, name.data(), value.size(), value.data()));
+    check_nc_error(nc_call(
+        nc_put_att_text, ncid, varid, name.data(), value.size(), value.data()));
 }
 
 void NCVar::put_attr(
     const std::string& name, const std::vector<double>& value) const
 {
-    check_nc_error(nc_put_att_double(
-        ncid, varid, name.data(), NC_DOUBLE, value.size(), value.data()));
+    check_nc_error(nc_call(
+        nc_put_att_double, ncid, varid, name.data(), NC_DOUBLE, value.size(),
+        value.data()));
 }
 
 void NCVar::put_attr(
     const std::string& name, const std::vector<float>& value) const
 {
-    check_nc_error(nc_put_att_float(
-        ncid, varid, name.data(), NC_FLOAT, value.size(), value.data()));
+    check_nc_error(nc_call(
+        nc_put_att_float, ncid, varid, name.data(), NC_FLOAT, value.size(),
+        value.data()));
 }
 
 void NCVar::put_attr(
     const std::string& name, const std::vector<int>& value) const
 {
-    check_nc_error(nc_put_att_int(
-        ncid, varid, name.data(), NC_INT, value.size(), value.data()));
+    check_nc_error(nc_call(
+        nc_put_att_int, ncid, varid, name.data(), NC_INT, value.size(),
+        value.data()));
 }
 
 std::string NCVar::get_attr(const std::string& name) const
 {
     size_t lenp;
     std::vector<char> aval;
-    check_nc_error(nc_inq_attlen(ncid, varid, name.data(), &lenp));
+    check_nc_error(nc_call(nc_inq_attlen, ncid, varid, name.data(), &lenp));
     aval.resize(lenp);
-    check_nc_error(nc_get_att_text(ncid, varid, name.data(), aval.data()));
+    check_nc_error(nc_call(
+        nc_get_att_text, ncid, varid, name.data(), aval.data()));
     return std::string{aval.begin(), aval.end()};
 }
 
 void NCVar::get_attr(const std::string& name, std::vector<double>& values) const
 {
     size_t lenp;
-    check_nc_error(nc_inq_attlen(ncid, varid, name.data(), &lenp));
+    check_nc_error(nc_call(nc_inq_attlen, ncid, varid, name.data(), &lenp));
     values.resize(lenp);
-    check_nc_error(nc_get_att_double(ncid, varid, name.data(), values.data()));
+    check_nc_error(nc_call(
+        nc_get_att_double, ncid, varid, name.data(), values.data()));
 }
 
 void NCVar::get_attr(const std::string& name, std::vector<float>& values) const
 {
     size_t lenp;
-    check_nc_error(nc_inq_attlen(ncid, varid, name.data(), &lenp));
+    check_nc_error(nc_call(nc_inq_attlen, ncid, varid, name.data(), &lenp));
     values.resize(lenp);
-    check_nc_error(nc_get_att_float(ncid, varid, name.data(), values.data()));
+    check_nc_error(nc_call(
+        nc_get_att_float, ncid, varid, name.data(), values.data()));
 }
 
 void NCVar::get_attr(const std::string& name, std::vector<int>& values) const
 {
     size_t lenp;
-    check_nc_error(nc_inq_attlen(ncid, varid, name.data(), &lenp));
+    check_nc_error(nc_call(nc_inq_attlen, ncid, varid, name.data(), &lenp));
     values.resize(lenp);
-    check_nc_error(nc_get_att_int(ncid, varid, name.data(), values.data()));
+    check_nc_error(nc_call(
+        nc_get_att_int, ncid, varid, name.data(), values.data()));
 }
 
 void NCVar::par_access(const int cmode) const
 {
-    check_nc_error(nc_var_par_access(ncid, varid, cmode));
+    check_nc_error(nc_call(nc_var_par_access, ncid, varid, cmode));
 }
 
 std::string NCGroup::name() const
 {
     size_t nlen;
     std::vector<char> grpname;
-    check_nc_error(nc_inq_grpname_len(ncid, &nlen));
+    check_nc_error(nc_call(nc_inq_grpname_len, ncid, &nlen));
     grpname.resize(nlen + 1);
-    check_nc_error(nc_inq_grpname(ncid, grpname.data()));
+    check_nc_error(nc_call(nc_inq_grpname, ncid, grpname.data()));
     return std::string{grpname.begin(), grpname.end()};
 }
 
@@ -294,44 +329,45 @@ std::string NCGroup::full_name() const
 {
     size_t nlen;
     std::vector<char> grpname;
-    check_nc_error(nc_inq_grpname_full(ncid, &nlen, NULL));
+    check_nc_error(nc_call(nc_inq_grpname_full, ncid, &nlen, nullptr));
     grpname.resize(nlen);
-    check_nc_error(nc_inq_grpname_full(ncid, &nlen, grpname.data()));
+    check_nc_error(nc_call(nc_inq_grpname_full, ncid, &nlen, grpname.data()));
     return std::string{grpname.begin(), grpname.end()};
 }
 
 NCGroup NCGroup::def_group(const std::string& name) const
 {
     int newid;
-    check_nc_error(nc_def_grp(ncid, name.data(), &newid));
+    check_nc_error(nc_call(nc_def_grp, ncid, name.data(), &newid));
     return NCGroup(newid, this);
 }
 
 NCGroup NCGroup::group(const std::string& name) const
 {
     int newid;
-    check_nc_error(nc_inq_ncid(ncid, name.data(), &newid));
+    check_nc_error(nc_call(nc_inq_ncid, ncid, name.data(), &newid));
     return NCGroup(newid, this);
 }
 
 NCDim NCGroup::dim(const std::string& name) const
 {
     int newid;
-    check_nc_error(nc_inq_dimid(ncid, name.data(), &newid));
+    check_nc_error(nc_call(nc_inq_dimid, ncid, name.data(), &newid));
     return NCDim{ncid, newid};
 }
 
 NCDim NCGroup::def_dim(const std::string& name, const size_t len) const
 {
     int newid;
-    check_nc_error(nc_def_dim(ncid, name.data(), len, &newid));
+    check_nc_error(nc_call(nc_def_dim, ncid, name.data(), len, &newid));
     return NCDim{ncid, newid};
 }
 
 NCVar NCGroup::def_scalar(const std::string& name, const nc_type dtype) const
 {
     int newid;
-    check_nc_error(nc_def_var(ncid, name.data(), dtype, 0, NULL, &newid));
+    check_nc_error(nc_call(
+        nc_def_var, ncid, name.data(), dtype, 0, nullptr, &newid));
     return NCVar{ncid, newid};
 }
 
@@ -345,61 +381,61 @@ NCVar NCGroup::def_array(
     std::vector<int> dimids(ndims);
     for (int i = 0; i < ndims; ++i) dimids[i] = dim(dnames[i]).dimid;
 
-    check_nc_error(
-        nc_def_var(ncid, name.data(), dtype, ndims, dimids.data(), &newid));
+    check_nc_error(nc_call(
+        nc_def_var, ncid, name.data(), dtype, ndims, dimids.data(), &newid));
     return NCVar{ncid, newid};
 }
 
 NCVar NCGroup::var(const std::string& name) const
 {
     int varid;
-    check_nc_error(nc_inq_varid(ncid, name.data(), &varid));
+    check_nc_error(nc_call(nc_inq_varid, ncid, name.data(), &varid));
     return NCVar{ncid, varid};
 }
 
 int NCGroup::num_groups() const
 {
     int ngrps;
-    check_nc_error(nc_inq_grps(ncid, &ngrps, NULL));
+    check_nc_error(nc_call(nc_inq_grps, ncid, &ngrps, nullptr));
     return ngrps;
 }
 
 int NCGroup::num_dimensions() const
 {
     int ndims;
-    check_nc_error(nc_inq(ncid, &ndims, NULL, NULL, NULL));
+    check_nc_error(nc_call(nc_inq, ncid, &ndims, nullptr, nullptr, nullptr));
     return ndims;
 }
 
 int NCGroup::num_attributes() const
 {
     int nattrs;
-    check_nc_error(nc_inq(ncid, NULL, NULL, &nattrs, NULL));
+    check_nc_error(nc_call(nc_inq, ncid, nullptr, nullptr, &nattrs, nullptr));
     return nattrs;
 }
 
 int NCGroup::num_variables() const
 {
     int nvars;
-    check_nc_error(nc_inq(ncid, NULL, &nvars, NULL, NULL));
+    check_nc_error(nc_call(nc_inq, ncid, nullptr, &nvars, nullptr, nullptr));
     return nvars;
 }
 
 bool NCGroup::has_group(const std::string& name) const
 {
-    int ierr = nc_inq_ncid(ncid, name.data(), NULL);
+    int ierr = nc_call(nc_inq_ncid, ncid, name.data(), nullptr);
     return (ierr == NC_NOERR);
 }
 
 bool NCGroup::has_dim(const std::string& name) const
 {
-    int ierr = nc_inq_dimid(ncid, name.data(), NULL);
+    int ierr = nc_call(nc_inq_dimid, ncid, name.data(), nullptr);
     return (ierr == NC_NOERR);
 }
 
 bool NCGroup::has_var(const std::string& name) const
 {
-    int ierr = nc_inq_varid(ncid, name.data(), NULL);
+    int ierr = nc_call(nc_inq_varid, ncid, name.data(), nullptr);
     return (ierr == NC_NOERR);
 }
 
@@ -407,44 +443,49 @@ bool NCGroup::has_attr(const std::string& name) const
 {
     int ierr;
     size_t lenp;
-    ierr = nc_inq_att(ncid, NC_GLOBAL, name.data(), NULL, &lenp);
+    ierr = nc_call(nc_inq_att, ncid, NC_GLOBAL, name.data(), nullptr, &lenp);
     return (ierr == NC_NOERR);
 }
 
 void NCGroup::put_attr(const std::string& name, const std::string& value) const
 {
-    check_nc_error(nc_put_att_text(
-        ncid, NC_GLOBAL, name.data(), value.size(), value.data()));
+    check_nc_error(nc_call(
+        nc_put_att_text, ncid, NC_GLOBAL, name.data(), value.size(),
+        value.data()));
 }
 
 void NCGroup::put_attr(
     const std::string& name, const std::vector<double>& value) const
 {
-    check_nc_error(nc_put_att_double(
-        ncid, NC_GLOBAL, name.data(), NC_DOUBLE, value.size(), value.data()));
+    check_nc_error(nc_call(
+        nc_put_att_double, ncid, NC_GLOBAL, name.data(), NC_DOUBLE,
+        value.size(), value.data()));
 }
 
 void NCGroup::put_attr(
     const std::string& name, const std::vector<float>& value) const
 {
-    check_nc_error(nc_put_att_float(
-        ncid, NC_GLOBAL, name.data(), NC_FLOAT, value.size(), value.data()));
+    check_nc_error(nc_call(
+        nc_put_att_float, ncid, NC_GLOBAL, name.data(), NC_FLOAT, value.size(),
+        value.data()));
 }
 
 void NCGroup::put_attr(
     const std::string& name, const std::vector<int>& value) const
 {
-    check_nc_error(nc_put_att_int(
-        ncid, NC_GLOBAL, name.data(), NC_INT, value.size(), value.data()));
+    check_nc_error(nc_call(
+        nc_put_att_int, ncid, NC_GLOBAL, name.data(), NC_INT, value.size(),
+        value.data()));
 }
 
 std::string NCGroup::get_attr(const std::string& name) const
 {
     size_t lenp;
     std::vector<char> aval;
-    check_nc_error(nc_inq_attlen(ncid, NC_GLOBAL, name.data(), &lenp));
+    check_nc_error(nc_call(nc_inq_attlen, ncid, NC_GLOBAL, name.data(), &lenp));
     aval.resize(lenp);
-    check_nc_error(nc_get_att_text(ncid, NC_GLOBAL, name.data(), aval.data()));
+    check_nc_error(nc_call(
+        nc_get_att_text, ncid, NC_GLOBAL, name.data(), aval.data()));
     return std::string{aval.begin(), aval.end()};
 }
 
@@ -452,28 +493,29 @@ void NCGroup::get_attr(
     const std::string& name, std::vector<double>& values) const
 {
     size_t lenp;
-    check_nc_error(nc_inq_attlen(ncid, NC_GLOBAL, name.data(), &lenp));
+    check_nc_error(nc_call(nc_inq_attlen, ncid, NC_GLOBAL, name.data(), &lenp));
     values.resize(lenp);
-    check_nc_error(
-        nc_get_att_double(ncid, NC_GLOBAL, name.data(), values.data()));
+    check_nc_error(nc_call(
+        nc_get_att_double, ncid, NC_GLOBAL, name.data(), values.data()));
 }
 
 void NCGroup::get_attr(
     const std::string& name, std::vector<float>& values) const
 {
     size_t lenp;
-    check_nc_error(nc_inq_attlen(ncid, NC_GLOBAL, name.data(), &lenp));
+    check_nc_error(nc_call(nc_inq_attlen, ncid, NC_GLOBAL, name.data(), &lenp));
     values.resize(lenp);
-    check_nc_error(
-        nc_get_att_float(ncid, NC_GLOBAL, name.data(), values.data()));
+    check_nc_error(nc_call(
+        nc_get_att_float, ncid, NC_GLOBAL, name.data(), values.data()));
 }
 
 void NCGroup::get_attr(const std::string& name, std::vector<int>& values) const
 {
     size_t lenp;
-    check_nc_error(nc_inq_attlen(ncid, NC_GLOBAL, name.data(), &lenp));
+    check_nc_error(nc_call(nc_inq_attlen, ncid, NC_GLOBAL, name.data(), &lenp));
     values.resize(lenp);
-    check_nc_error(nc_get_att_int(ncid, NC_GLOBAL, name.data(), values.data()));
+    check_nc_error(nc_call(
+        nc_get_att_int, ncid, NC_GLOBAL, name.data(), values.data()));
 }
 
 std::vector<NCGroup> NCGroup::all_groups() const
@@ -485,7 +527,7 @@ std::vector<NCGroup> NCGroup::all_groups() const
     if (ngrps < 1) return grps;
 
     std::vector<int> gids(ngrps);
-    check_nc_error(nc_inq_grps(ncid, &ngrps, gids.data()));
+    check_nc_error(nc_call(nc_inq_grps, ncid, &ngrps, gids.data()));
     grps.reserve(ngrps);
     for (int i = 0; i < ngrps; ++i) grps.emplace_back(NCGroup(gids[i], this));
     return grps;
@@ -516,7 +558,7 @@ std::vector<NCVar> NCGroup::all_vars() const
 void NCGroup::enter_def_mode() const
 {
     int ierr;
-    ierr = nc_redef(ncid);
+    ierr = nc_call(nc_redef, ncid);
 
     // Ignore already in define mode error
     if (ierr == NC_EINDEFINE) return;
@@ -524,19 +566,22 @@ void NCGroup::enter_def_mode() const
     check_nc_error(ierr);
 }
 
-void NCGroup::exit_def_mode() const { check_nc_error(nc_enddef(ncid)); }
+void NCGroup::exit_def_mode() const
+{
+    check_nc_error(nc_call(nc_enddef, ncid));
+}
 
 NCFile NCFile::create(const std::string& name, const int cmode)
 {
     int ncid;
-    check_nc_error(nc_create(name.data(), cmode, &ncid));
+    check_nc_error(nc_call(nc_create, name.data(), cmode, &ncid));
     return NCFile(ncid);
 }
 
 NCFile NCFile::open(const std::string& name, const int cmode)
 {
     int ncid;
-    check_nc_error(nc_open(name.data(), cmode, &ncid));
+    check_nc_error(nc_call(nc_open, name.data(), cmode, &ncid));
     return NCFile(ncid);
 }
 
@@ -544,7 +589,8 @@ NCFile NCFile::create_par(
     const std::string& name, const int cmode, MPI_Comm comm, MPI_Info info)
 {
     int ncid;
-    check_nc_error(nc_create_par(name.data(), cmode, comm, info, &ncid));
+    check_nc_error(nc_call(
+        nc_create_par, name.data(), cmode, comm, info, &ncid));
     return NCFile(ncid);
 }
 
@@ -552,19 +598,19 @@ NCFile NCFile::open_par(
     const std::string& name, const int cmode, MPI_Comm comm, MPI_Info info)
 {
     int ncid;
-    check_nc_error(nc_open_par(name.data(), cmode, comm, info, &ncid));
+    check_nc_error(nc_call(nc_open_par, name.data(), cmode, comm, info, &ncid));
     return NCFile(ncid);
 }
 
 NCFile::~NCFile()
 {
-    if (is_open) check_nc_error(nc_close(ncid));
+    if (is_open) check_nc_error(nc_call(nc_close, ncid));
 }
 
 void NCFile::close()
 {
     is_open = false;
-    check_nc_error(nc_close(ncid));
+    check_nc_error(nc_call(nc_close, ncid));
 }
 
 } // namespace ncutils
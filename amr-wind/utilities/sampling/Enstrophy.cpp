@@ -5,10 +5,29 @@
 #include <utility>
 #include "AMReX_ParmParse.H"
 #include "amr-wind/utilities/IOManager.H"
+#include "amr-wind/utilities/ReductionEngine.H"
 #include "amr-wind/fvm/vorticity_mag.H"
 
 namespace amr_wind::enstrophy {
 
+namespace {
+
+//! Enstrophy in a cell
+struct EnstrophyOp
+{
+    amrex::Array4<const amrex::Real> den;
+    amrex::Array4<const amrex::Real> vort;
+    amrex::Real cell_vol;
+
+    AMREX_GPU_DEVICE AMREX_FORCE_INLINE amrex::Real
+    operator()(const int i, const int j, const int k) const noexcept
+    {
+        return cell_vol * den(i, j, k) * (vort(i, j, k) * vort(i, j, k));
+    }
+};
+
+} // namespace
+
 Enstrophy::Enstrophy(CFDSim& sim, std::string label)
     : m_sim(sim)
     , m_label(std::move(label))
@@ -24,6 +43,19 @@ void Enstrophy::initialize()
     amrex::ParmParse pp(m_label);
     pp.query("output_frequency", m_out_freq);
 
+    auto& reductions = m_sim.post_manager().reductions();
+    m_qid = reductions.add(
+        ReductionEngine::ReduceType::Sum, m_out_freq,
+        [this](const int lev, const amrex::MFIter& mfi) {
+            const auto& geom = m_velocity.repo().mesh().Geom(lev);
+            return EnstrophyOp{
+                m_density(lev).const_array(mfi),
+                (*m_vorticity)(lev).const_array(mfi),
+                geom.CellSize()[0] * geom.CellSize()[1] * geom.CellSize()[2]};
+        });
+    reductions.set_prepare(
+        m_qid, [this]() { m_vorticity = fvm::vorticity_mag(m_velocity); });
+
     prepare_ascii_file();
 }
 
@@ -32,58 +64,14 @@ amrex::Real Enstrophy::calculate_enstrophy()
     BL_PROFILE("amr-wind::Enstrophy::calculate_enstrophy");
 
     // integrated total Enstrophy
-    amrex::Real total_enstrophy = 0.0;
-
-    const int finest_level = m_velocity.repo().num_active_levels() - 1;
-    const auto& geom = m_velocity.repo().mesh().Geom();
-
-    auto vorticity = amr_wind::fvm::vorticity_mag(m_velocity);
-
-    for (int lev = 0; lev <= finest_level; lev++) {
-
-        amrex::iMultiFab level_mask;
-        if (lev < finest_level) {
-            level_mask = makeFineMask(
-                m_sim.mesh().boxArray(lev), m_sim.mesh().DistributionMap(lev),
-                m_sim.mesh().boxArray(lev + 1), amrex::IntVect(2), 1, 0);
-        } else {
-            level_mask.define(
-                m_sim.mesh().boxArray(lev), m_sim.mesh().DistributionMap(lev),
-                1, 0, amrex::MFInfo());
-            level_mask.setVal(1);
-        }
-
-        const amrex::Real cell_vol = geom[lev].CellSize()[0] *
-                                     geom[lev].CellSize()[1] *
-                                     geom[lev].CellSize()[2];
-
-        total_enstrophy += amrex::ReduceSum(
-            m_density(lev), (*vorticity)(lev), level_mask, 0,
-            [=] AMREX_GPU_HOST_DEVICE(
-                amrex::Box const& bx,
-                amrex::Array4<amrex::Real const> const& den_arr,
-                amrex::Array4<amrex::Real const> const& vort_arr,
-                amrex::Array4<int const> const& mask_arr) -> amrex::Real {
-                amrex::Real enstrophy_fab = 0.0;
-
-                amrex::Loop(
-                    bx, [=, &enstrophy_fab](int i, int j, int k) noexcept {
-                        enstrophy_fab +=
-                            cell_vol * mask_arr(i, j, k) * den_arr(i, j, k) *
-                            (vort_arr(i, j, k) * vort_arr(i, j, k));
-                    });
-                return enstrophy_fab;
-            });
-    }
+    const amrex::Real total_enstrophy =
+        m_sim.post_manager().reductions().value(m_qid);
 
     // total volume of grid on level 0
+    const auto& geom = m_velocity.repo().mesh().Geom();
     const amrex::Real total_vol = geom[0].ProbDomain().volume();
 
-    total_enstrophy *= 0.5 / total_vol;
-
-    amrex::ParallelDescriptor::ReduceRealSum(total_enstrophy);
-
-    return total_enstrophy;
+    return total_enstrophy * 0.5 / total_vol;
 }
 
 void Enstrophy::post_advance_work()
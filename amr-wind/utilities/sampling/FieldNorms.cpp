@@ -5,9 +5,35 @@
 #include <utility>
 #include "AMReX_ParmParse.H"
 #include "amr-wind/utilities/IOManager.H"
+#include "amr-wind/utilities/ReductionEngine.H"
 
 namespace amr_wind::field_norms {
 
+namespace {
+
+//! Contribution of a cell to the squared L2 norm of a field component
+struct SquaredNormOp
+{
+    amrex::Array4<const amrex::Real> fld;
+    int comp;
+    amrex::Real cell_vol;
+
+    AMREX_GPU_DEVICE AMREX_FORCE_INLINE amrex::Real
+    operator()(const int i, const int j, const int k) const noexcept
+    {
+        return cell_vol * fld(i, j, k, comp) * fld(i, j, k, comp);
+    }
+};
+
+//! Cell volume at a level
+amrex::Real cell_volume(const Field& fld, const int lev)
+{
+    const auto& geom = fld.repo().mesh().Geom(lev);
+    return geom.CellSize()[0] * geom.CellSize()[1] * geom.CellSize()[2];
+}
+
+} // namespace
+
 FieldNorms::FieldNorms(CFDSim& sim, std::string label)
     : m_sim(sim), m_label(std::move(label))
 {}
@@ -30,55 +56,38 @@ void FieldNorms::initialize()
 
     m_fnorms.resize(m_var_names.size(), 0.0);
 
-    prepare_ascii_file();
-}
-
-amrex::Real FieldNorms::L2_norm(amr_wind::Field& field, const int comp)
-{
-    amrex::Real nrm = 0.0;
-
-    AMREX_ASSERT(comp >= 0 && comp < field.num_comp());
-
-    const int finest_level = field.repo().num_active_levels() - 1;
-    const auto& geom = field.repo().mesh().Geom();
-    constexpr int nghost = 0;
-
-    for (int lev = 0; lev <= finest_level; lev++) {
-
-        const amrex::Real cell_vol = geom[lev].CellSize()[0] *
-                                     geom[lev].CellSize()[1] *
-                                     geom[lev].CellSize()[2];
-
-        nrm += amrex::ReduceSum(
-            field(lev), nghost,
-            [=] AMREX_GPU_HOST_DEVICE(
-                amrex::Box const& bx,
-                amrex::Array4<amrex::Real const> const& field_arr)
-                -> amrex::Real {
-                amrex::Real nrm_fab = 0.0;
-
-                amrex::Loop(bx, [=, &nrm_fab](int i, int j, int k) noexcept {
-                    nrm_fab += cell_vol * field_arr(i, j, k, comp) *
-                               field_arr(i, j, k, comp);
-                });
-                return nrm_fab;
-            });
+    // Register the squared norms of all the components with the reduction
+    // engine so that they are evaluated in a single sweep. As before, the
+    // contributions of all the cells (or nodes, for nodal fields) of each
+    // box are summed at every level, including the regions covered by a
+    // finer level.
+    auto& reductions = m_sim.post_manager().reductions();
+    for (auto* fld : io_mng.plot_fields()) {
+        const auto nodal =
+            field_impl::index_type(fld->field_location()).ixType();
+        for (int comp = 0; comp < fld->num_comp(); ++comp) {
+            m_qids.push_back(reductions.add(
+                ReductionEngine::ReduceType::Sum, m_out_freq,
+                [fld, comp](const int lev, const amrex::MFIter& mfi) {
+                    return SquaredNormOp{
+                        (*fld)(lev).const_array(mfi), comp,
+                        cell_volume(*fld, lev)};
+                },
+                false, nodal));
+        }
     }
 
-    amrex::ParallelDescriptor::ReduceRealSum(nrm);
-
-    const amrex::Real total_volume = geom[0].ProbDomain().volume();
-
-    return std::sqrt(nrm / total_volume);
+    prepare_ascii_file();
 }
 
 void FieldNorms::process_field_norms()
 {
-    int ind = 0;
-    for (const auto& fld : m_sim.io_manager().plot_fields()) {
-        for (int comp = 0; comp < fld->num_comp(); ++comp) {
-            m_fnorms[ind++] = L2_norm(*fld, comp);
-        }
+    auto& reductions = m_sim.post_manager().reductions();
+    const auto& geom = m_sim.repo().mesh().Geom();
+    const amrex::Real total_volume = geom[0].ProbDomain().volume();
+    for (int ind = 0; ind < m_qids.size(); ++ind) {
+        m_fnorms[ind] =
+            std::sqrt(reductions.value(m_qids[ind]) / total_volume);
     }
 }
 
@@ -3,6 +3,7 @@
 #include <AMReX_MultiFabUtil.H>
 #include <utility>
 #include "amr-wind/utilities/ncutils/nc_interface.H"
+#include "amr-wind/utilities/TaskScheduler.H"
 #include "amr-wind/equation_systems/vof/volume_fractions.H"
 
 #include "AMReX_ParmParse.H"
@@ -104,17 +105,7 @@ void FreeSurface::initialize()
     const int finest_level = m_vof.repo().num_active_levels() - 1;
     for (int lev = 0; lev <= finest_level; lev++) {
         // Use level_mask to only count finest level present
-        amrex::iMultiFab level_mask;
-        if (lev < finest_level) {
-            level_mask = makeFineMask(
-                m_sim.mesh().boxArray(lev), m_sim.mesh().DistributionMap(lev),
-                m_sim.mesh().boxArray(lev + 1), amrex::IntVect(2), 1, 0);
-        } else {
-            level_mask.define(
-                m_sim.mesh().boxArray(lev), m_sim.mesh().DistributionMap(lev),
-                1, 0, amrex::MFInfo());
-            level_mask.setVal(1);
-        }
+        const auto& level_mask = m_sim.repo().fine_masks().cell_mask(lev);
         // Get geometry information
         const auto& geom = m_sim.mesh().Geom(lev);
         const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> dx =
@@ -218,17 +209,7 @@ void FreeSurface::initialize()
     // Store locations and indices in fields
     for (int lev = 0; lev <= finest_level; lev++) {
         // Use level_mask to only count finest level present
-        amrex::iMultiFab level_mask;
-        if (lev < finest_level) {
-            level_mask = makeFineMask(
-                m_sim.mesh().boxArray(lev), m_sim.mesh().DistributionMap(lev),
-                m_sim.mesh().boxArray(lev + 1), amrex::IntVect(2), 1, 0);
-        } else {
-            level_mask.define(
-                m_sim.mesh().boxArray(lev), m_sim.mesh().DistributionMap(lev),
-                1, 0, amrex::MFInfo());
-            level_mask.setVal(1);
-        }
+        const auto& level_mask = m_sim.repo().fine_masks().cell_mask(lev);
         // Get geometry information
         const auto& geom = m_sim.mesh().Geom(lev);
         const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> dx =
@@ -570,17 +551,7 @@ void FreeSurface::post_regrid_actions()
     const int finest_level = m_vof.repo().num_active_levels() - 1;
     for (int lev = 0; lev <= finest_level; lev++) {
         // Use level_mask to only count finest level present
-        amrex::iMultiFab level_mask;
-        if (lev < finest_level) {
-            level_mask = makeFineMask(
-                m_sim.mesh().boxArray(lev), m_sim.mesh().DistributionMap(lev),
-                m_sim.mesh().boxArray(lev + 1), amrex::IntVect(2), 1, 0);
-        } else {
-            level_mask.define(
-                m_sim.mesh().boxArray(lev), m_sim.mesh().DistributionMap(lev),
-                1, 0, amrex::MFInfo());
-            level_mask.setVal(1);
-        }
+        const auto& level_mask = m_sim.repo().fine_masks().cell_mask(lev);
         // Get geometry information
         const auto& geom = m_sim.mesh().Geom(lev);
         const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> dx =
@@ -835,27 +806,31 @@ void FreeSurface::write_netcdf()
 #ifdef AMR_WIND_USE_NETCDF
 
     if (!amrex::ParallelDescriptor::IOProcessor()) return;
-    auto ncf = ncutils::NCFile::open(m_ncfile_name, NC_WRITE);
-    const std::string nt_name = "num_time_steps";
-    // Index of the next timestep
-    const size_t nt = ncf.dim(nt_name).len();
-    {
-        auto time = m_sim.time().new_time();
-        ncf.var("time").put(&time, {nt}, {1});
-    }
-
-    std::vector<size_t> start{nt, 0, 0};
-    std::vector<size_t> count{1, 0, 0};
 
-    count[1] = 1;
-    count[2] = m_npts;
-    auto var = ncf.var("heights");
-    for (int ni = 0; ni < m_ninst; ++ni) {
-        var.put(&m_out[ni * m_npts], start, count);
-        ++start[1];
-    }
+    // Write a copy of the heights while the solver proceeds
+    const double time = m_sim.time().new_time();
+    m_sim.post_manager().tasks().submit(
+        [fname = m_ncfile_name, heights = m_out, time, npts = m_npts,
+         ninst = m_ninst]() {
+            auto ncf = ncutils::NCFile::open(fname, NC_WRITE);
+            const std::string nt_name = "num_time_steps";
+            // Index of the next timestep
+            const size_t nt = ncf.dim(nt_name).len();
+            ncf.var("time").put(&time, {nt}, {1});
+
+            std::vector<size_t> start{nt, 0, 0};
+            std::vector<size_t> count{1, 0, 0};
+
+            count[1] = 1;
+            count[2] = npts;
+            auto var = ncf.var("heights");
+            for (int ni = 0; ni < ninst; ++ni) {
+                var.put(&heights[ni * npts], start, count);
+                ++start[1];
+            }
 
-    ncf.close();
+            ncf.close();
+        });
 #endif
 }
 
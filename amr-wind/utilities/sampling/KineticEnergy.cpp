@@ -5,9 +5,31 @@
 #include <utility>
 #include "AMReX_ParmParse.H"
 #include "amr-wind/utilities/IOManager.H"
+#include "amr-wind/utilities/ReductionEngine.H"
 
 namespace amr_wind::kinetic_energy {
 
+namespace {
+
+//! Kinetic energy in a cell
+struct KineticEnergyOp
+{
+    amrex::Array4<const amrex::Real> den;
+    amrex::Array4<const amrex::Real> vel;
+    amrex::Real cell_vol;
+
+    AMREX_GPU_DEVICE AMREX_FORCE_INLINE amrex::Real
+    operator()(const int i, const int j, const int k) const noexcept
+    {
+        return cell_vol * den(i, j, k) *
+               (vel(i, j, k, 0) * vel(i, j, k, 0) +
+                vel(i, j, k, 1) * vel(i, j, k, 1) +
+                vel(i, j, k, 2) * vel(i, j, k, 2));
+    }
+};
+
+} // namespace
+
 KineticEnergy::KineticEnergy(CFDSim& sim, std::string label)
     : m_sim(sim)
     , m_label(std::move(label))
@@ -23,6 +45,16 @@ void KineticEnergy::initialize()
     amrex::ParmParse pp(m_label);
     pp.query("output_frequency", m_out_freq);
 
+    m_qid = m_sim.post_manager().reductions().add(
+        ReductionEngine::ReduceType::Sum, m_out_freq,
+        [this](const int lev, const amrex::MFIter& mfi) {
+            const auto& geom = m_velocity.repo().mesh().Geom(lev);
+            return KineticEnergyOp{
+                m_density(lev).const_array(mfi),
+                m_velocity(lev).const_array(mfi),
+                geom.CellSize()[0] * geom.CellSize()[1] * geom.CellSize()[2]};
+        });
+
     prepare_ascii_file();
 }
 
@@ -31,58 +63,14 @@ amrex::Real KineticEnergy::calculate_kinetic_energy()
     BL_PROFILE("amr-wind::KineticEnergy::calculate_kinetic_energy");
 
     // integrated total Kinetic Energy
-    amrex::Real Kinetic_energy = 0.0;
-
-    const int finest_level = m_velocity.repo().num_active_levels() - 1;
-    const auto& geom = m_velocity.repo().mesh().Geom();
-
-    for (int lev = 0; lev <= finest_level; lev++) {
-
-        amrex::iMultiFab level_mask;
-        if (lev < finest_level) {
-            level_mask = makeFineMask(
-                m_sim.mesh().boxArray(lev), m_sim.mesh().DistributionMap(lev),
-                m_sim.mesh().boxArray(lev + 1), amrex::IntVect(2), 1, 0);
-        } else {
-            level_mask.define(
-                m_sim.mesh().boxArray(lev), m_sim.mesh().DistributionMap(lev),
-                1, 0, amrex::MFInfo());
-            level_mask.setVal(1);
-        }
-
-        const amrex::Real cell_vol = geom[lev].CellSize()[0] *
-                                     geom[lev].CellSize()[1] *
-                                     geom[lev].CellSize()[2];
-
-        Kinetic_energy += amrex::ReduceSum(
-            m_density(lev), m_velocity(lev), level_mask, 0,
-            [=] AMREX_GPU_HOST_DEVICE(
-                amrex::Box const& bx,
-                amrex::Array4<amrex::Real const> const& den_arr,
-                amrex::Array4<amrex::Real const> const& vel_arr,
-                amrex::Array4<int const> const& mask_arr) -> amrex::Real {
-                amrex::Real Kinetic_Energy_Fab = 0.0;
-
-                amrex::Loop(
-                    bx, [=, &Kinetic_Energy_Fab](int i, int j, int k) noexcept {
-                        Kinetic_Energy_Fab +=
-                            cell_vol * mask_arr(i, j, k) * den_arr(i, j, k) *
-                            (vel_arr(i, j, k, 0) * vel_arr(i, j, k, 0) +
-                             vel_arr(i, j, k, 1) * vel_arr(i, j, k, 1) +
-                             vel_arr(i, j, k, 2) * vel_arr(i, j, k, 2));
-                    });
-                return Kinetic_Energy_Fab;
-            });
-    }
+    const amrex::Real Kinetic_energy =
+        m_sim.post_manager().reductions().value(m_qid);
 
     // total volume of grid on level 0
+    const auto& geom = m_velocity.repo().mesh().Geom();
     const amrex::Real total_vol = geom[0].ProbDomain().volume();
 
-    Kinetic_energy *= 0.5 / total_vol;
-
-    amrex::ParallelDescriptor::ReduceRealSum(Kinetic_energy);
-
-    return Kinetic_energy;
+    return Kinetic_energy * 0.5 / total_vol;
 }
 
 void KineticEnergy::post_advance_work()
@@ -4,6 +4,8 @@
 #include "amr-wind/utilities/sampling/Sampling.H"
 #include "amr-wind/utilities/io_utils.H"
 #include "amr-wind/utilities/ncutils/nc_interface.H"
+#include "amr-wind/utilities/PerfMonitor.H"
+#include "amr-wind/utilities/TaskScheduler.H"
 
 #include "AMReX_ParmParse.H"
 
@@ -92,11 +94,33 @@ void Sampling::update_sampling_locations()
 {
     BL_PROFILE("amr-wind::Sampling::update_sampling_locations");
 
+    // Static samplers never change, so the container is only updated if some
+    // of the samplers are moving
+    bool has_moving = false;
+    bool is_resized = false;
     for (const auto& obj : m_samplers) {
+        if (!obj->is_moving()) {
+            continue;
+        }
+        const int npts = obj->num_points();
         obj->update_sampling_locations();
+        has_moving = true;
+        is_resized = is_resized || (npts != obj->num_points());
     }
 
-    update_container();
+    if (!has_moving) {
+        return;
+    }
+
+    if (is_resized) {
+        // The number of particles changed, rebuild the container
+        update_container();
+    } else {
+        // Move the particles in place and let redistribute migrate only the
+        // particles that left their boxes
+        m_scontainer->update_positions(m_samplers);
+        m_scontainer->Redistribute();
+    }
 }
 
 void Sampling::post_advance_work()
@@ -113,6 +137,11 @@ void Sampling::post_advance_work()
     update_sampling_locations();
 
     m_scontainer->interpolate_fields(m_fields);
+    if (m_sim.perf_monitor().enabled()) {
+        m_sim.perf_monitor().add(
+            PerfMonitor::Counter::Particles,
+            m_scontainer->TotalNumberOfParticles(true, true));
+    }
 
     process_output();
 }
@@ -237,14 +266,27 @@ void Sampling::write_netcdf()
     m_scontainer->populate_buffer(buf);
 
     if (!amrex::ParallelDescriptor::IOProcessor()) return;
+
+    // The gathered data is written to disk while the solver proceeds
+    const double time = m_sim.time().new_time();
+    const int npart = m_scontainer->num_sampling_particles();
+    m_sim.post_manager().tasks().submit(
+        [this, buf = std::move(buf), time, npart]() mutable {
+            write_netcdf_data(buf, time, npart);
+        });
+#endif
+}
+
+void Sampling::write_netcdf_data(
+    std::vector<double>& buf, const double time, const int npart)
+{
+#ifdef AMR_WIND_USE_NETCDF
+    BL_PROFILE("amr-wind::Sampling::write_netcdf_data");
     auto ncf = ncutils::NCFile::open(m_ncfile_name, NC_WRITE);
     const std::string nt_name = "num_time_steps";
     // Index of the next timestep
     const size_t nt = ncf.dim(nt_name).len();
-    {
-        auto time = m_sim.time().new_time();
-        ncf.var("time").put(&time, {nt}, {1});
-    }
+    ncf.var("time").put(&time, {nt}, {1});
 
     for (const auto& obj : m_samplers) {
         auto grp = ncf.group(obj->label());
@@ -258,7 +300,7 @@ void Sampling::write_netcdf()
     for (int iv = 0; iv < nvars; ++iv) {
         start[1] = 0;
         count[1] = 0;
-        int offset = iv * m_scontainer->num_sampling_particles();
+        int offset = iv * npart;
         for (const auto& obj : m_samplers) {
             auto grp = ncf.group(obj->label());
             auto var = grp.var(m_var_names[iv]);
@@ -273,6 +315,8 @@ void Sampling::write_netcdf()
         }
     }
     ncf.close();
+#else
+    amrex::ignore_unused(buf, time, npart);
 #endif
 }
 
@@ -153,6 +153,66 @@ void SamplingContainer::initialize_particles(
     AMREX_ALWAYS_ASSERT(pidx == num_particles);
 }
 
+void SamplingContainer::update_positions(
+    const amrex::Vector<std::unique_ptr<SamplerBase>>& samplers)
+{
+    BL_PROFILE("amr-wind::SamplingContainer::update_positions");
+
+    // Offsets of the moving samplers into the list of locations, indexed by the
+    // sampler ID. Particles belonging to static samplers are not updated.
+    int max_id = 0;
+    for (const auto& probe : samplers) {
+        max_id = amrex::max(max_id, probe->id());
+    }
+    amrex::Vector<int> offsets(max_id + 1, -1);
+    SamplerBase::SampleLocType locs;
+    SamplerBase::SampleLocType probe_locs;
+    for (const auto& probe : samplers) {
+        if (!probe->is_moving()) {
+            continue;
+        }
+        probe->sampling_locations(probe_locs);
+        offsets[probe->id()] = static_cast<int>(locs.size());
+        locs.insert(
+            locs.end(), probe_locs.begin(),
+            probe_locs.begin() + probe->num_points());
+    }
+
+    amrex::Gpu::DeviceVector<int> doffsets(offsets.size());
+    amrex::Gpu::DeviceVector<amrex::Array<amrex::Real, AMREX_SPACEDIM>> dlocs(
+        locs.size());
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, offsets.begin(), offsets.end(),
+        doffsets.begin());
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, locs.begin(), locs.end(), dlocs.begin());
+    const auto* doff = doffsets.data();
+    const auto* dpos = dlocs.data();
+
+    const int nlevels = m_mesh.finestLevel() + 1;
+    for (int lev = 0; lev < nlevels; ++lev) {
+        for (ParIterType pti(*this, lev); pti.isValid(); ++pti) {
+            const int np = pti.numParticles();
+            auto* pstruct = pti.GetArrayOfStructs()().data();
+
+            amrex::ParallelFor(
+                np, [=] AMREX_GPU_DEVICE(const int ip) noexcept {
+                    auto& pp = pstruct[ip];
+                    const int offset = doff[pp.idata(IIx::sid)];
+                    if (offset < 0) {
+                        return;
+                    }
+
+                    const int idx = offset + pp.idata(IIx::nid);
+                    for (int n = 0; n < AMREX_SPACEDIM; ++n) {
+                        pp.pos(n) = dpos[idx][n];
+                    }
+                });
+        }
+    }
+    amrex::Gpu::streamSynchronize();
+}
+
 void SamplingContainer::interpolate_fields(const amrex::Vector<Field*> fields)
 {
     BL_PROFILE("amr-wind::SamplingContainer::interpolate");
@@ -6,9 +6,51 @@
 #include <utility>
 #include "AMReX_ParmParse.H"
 #include "amr-wind/utilities/IOManager.H"
+#include "amr-wind/utilities/ReductionEngine.H"
 
 namespace amr_wind::wave_energy {
 
+namespace {
+
+//! Kinetic energy of the liquid in a cell
+struct WaveKineticEnergyOp
+{
+    amrex::Array4<const amrex::Real> vof;
+    amrex::Array4<const amrex::Real> vel;
+    amrex::Real cell_vol;
+
+    AMREX_GPU_DEVICE AMREX_FORCE_INLINE amrex::Real
+    operator()(const int i, const int j, const int k) const noexcept
+    {
+        return cell_vol * 0.5 * vof(i, j, k) *
+               (vel(i, j, k, 0) * vel(i, j, k, 0) +
+                vel(i, j, k, 1) * vel(i, j, k, 1) +
+                vel(i, j, k, 2) * vel(i, j, k, 2));
+    }
+};
+
+//! Potential energy of the liquid in a cell
+struct WavePotentialEnergyOp
+{
+    amrex::Array4<const amrex::Real> vof;
+    amrex::Real cell_vol;
+    amrex::Real dz;
+    amrex::Real probloz;
+    amrex::Real g;
+
+    AMREX_GPU_DEVICE AMREX_FORCE_INLINE amrex::Real
+    operator()(const int i, const int j, const int k) const noexcept
+    {
+        // Crude model of liquid height in multiphase cells
+        amrex::Real kk = (vof(i, j, k + 1) > vof(i, j, k)) ? k + 1 : k;
+        amrex::Real dir = (vof(i, j, k + 1) > vof(i, j, k)) ? -1 : 1;
+        const amrex::Real zl = probloz + (kk + dir * 0.5 * vof(i, j, k)) * dz;
+        return cell_vol * vof(i, j, k) * g * zl;
+    }
+};
+
+} // namespace
+
 WaveEnergy::WaveEnergy(CFDSim& sim, std::string label)
     : m_sim(sim)
     , m_label(std::move(label))
@@ -41,125 +83,40 @@ void WaveEnergy::initialize()
              (geom[0].ProbHi()[1] - geom[0].ProbLo()[1]) * depth;
     m_pe_off = -0.5 * m_gravity[2] * depth;
 
+    auto& reductions = m_sim.post_manager().reductions();
+    m_ke_qid = reductions.add(
+        ReductionEngine::ReduceType::Sum, m_out_freq,
+        [this](const int lev, const amrex::MFIter& mfi) {
+            const auto& lgeom = m_velocity.repo().mesh().Geom(lev);
+            return WaveKineticEnergyOp{
+                m_vof(lev).const_array(mfi), m_velocity(lev).const_array(mfi),
+                lgeom.CellSize()[0] * lgeom.CellSize()[1] *
+                    lgeom.CellSize()[2]};
+        });
+    m_pe_qid = reductions.add(
+        ReductionEngine::ReduceType::Sum, m_out_freq,
+        [this](const int lev, const amrex::MFIter& mfi) {
+            const auto& lgeom = m_velocity.repo().mesh().Geom(lev);
+            return WavePotentialEnergyOp{
+                m_vof(lev).const_array(mfi),
+                lgeom.CellSize()[0] * lgeom.CellSize()[1] *
+                    lgeom.CellSize()[2],
+                lgeom.CellSize()[2], lgeom.ProbLo()[2], -m_gravity[2]};
+        });
+
     prepare_ascii_file();
 }
 
 amrex::Real WaveEnergy::calculate_kinetic_energy()
 {
     BL_PROFILE("amr-wind::WaveEnergy::calculate_kinetic_energy");
-
-    // integrated total wave Energy
-    amrex::Real wave_ke = 0.0;
-
-    const int finest_level = m_velocity.repo().num_active_levels() - 1;
-    const auto& geom = m_velocity.repo().mesh().Geom();
-
-    for (int lev = 0; lev <= finest_level; lev++) {
-
-        amrex::iMultiFab level_mask;
-        if (lev < finest_level) {
-            level_mask = makeFineMask(
-                m_sim.mesh().boxArray(lev), m_sim.mesh().DistributionMap(lev),
-                m_sim.mesh().boxArray(lev + 1), amrex::IntVect(2), 1, 0);
-        } else {
-            level_mask.define(
-                m_sim.mesh().boxArray(lev), m_sim.mesh().DistributionMap(lev),
-                1, 0, amrex::MFInfo());
-            level_mask.setVal(1);
-        }
-
-        const amrex::Real cell_vol = geom[lev].CellSize()[0] *
-                                     geom[lev].CellSize()[1] *
-                                     geom[lev].CellSize()[2];
-
-        wave_ke += amrex::ReduceSum(
-            m_vof(lev), m_velocity(lev), level_mask, 0,
-            [=] AMREX_GPU_HOST_DEVICE(
-                amrex::Box const& bx,
-                amrex::Array4<amrex::Real const> const& vof_arr,
-                amrex::Array4<amrex::Real const> const& vel_arr,
-                amrex::Array4<int const> const& mask_arr) -> amrex::Real {
-                amrex::Real Wave_Energy_Fab = 0.0;
-
-                amrex::Loop(
-                    bx, [=, &Wave_Energy_Fab](int i, int j, int k) noexcept {
-                        Wave_Energy_Fab +=
-                            cell_vol * mask_arr(i, j, k) * 0.5 *
-                            vof_arr(i, j, k) *
-                            (vel_arr(i, j, k, 0) * vel_arr(i, j, k, 0) +
-                             vel_arr(i, j, k, 1) * vel_arr(i, j, k, 1) +
-                             vel_arr(i, j, k, 2) * vel_arr(i, j, k, 2));
-                    });
-                return Wave_Energy_Fab;
-            });
-    }
-
-    amrex::ParallelDescriptor::ReduceRealSum(wave_ke);
-
-    return wave_ke;
+    return m_sim.post_manager().reductions().value(m_ke_qid);
 }
 
 amrex::Real WaveEnergy::calculate_potential_energy()
 {
     BL_PROFILE("amr-wind::WaveEnergy::calculate_potential_energy");
-
-    // integrated total wave Energy
-    amrex::Real wave_pe = 0.0;
-    // gravity constant
-    const amrex::Real g = -m_gravity[2];
-
-    const int finest_level = m_velocity.repo().num_active_levels() - 1;
-    const auto& geom = m_velocity.repo().mesh().Geom();
-
-    for (int lev = 0; lev <= finest_level; lev++) {
-
-        amrex::iMultiFab level_mask;
-        if (lev < finest_level) {
-            level_mask = makeFineMask(
-                m_sim.mesh().boxArray(lev), m_sim.mesh().DistributionMap(lev),
-                m_sim.mesh().boxArray(lev + 1), amrex::IntVect(2), 1, 0);
-        } else {
-            level_mask.define(
-                m_sim.mesh().boxArray(lev), m_sim.mesh().DistributionMap(lev),
-                1, 0, amrex::MFInfo());
-            level_mask.setVal(1);
-        }
-
-        const amrex::Real cell_vol = geom[lev].CellSize()[0] *
-                                     geom[lev].CellSize()[1] *
-                                     geom[lev].CellSize()[2];
-
-        const amrex::Real dz = geom[lev].CellSize()[2];
-        const amrex::Real probloz = geom[lev].ProbLo()[2];
-
-        wave_pe += amrex::ReduceSum(
-            m_vof(lev), level_mask, 0,
-            [=] AMREX_GPU_HOST_DEVICE(
-                amrex::Box const& bx,
-                amrex::Array4<amrex::Real const> const& vof_arr,
-                amrex::Array4<int const> const& mask_arr) -> amrex::Real {
-                amrex::Real Wave_Energy_Fab = 0.0;
-
-                amrex::Loop(
-                    bx, [=, &Wave_Energy_Fab](int i, int j, int k) noexcept {
-                        // Crude model of liquid height in multiphase cells
-                        amrex::Real kk =
-                            (vof_arr(i, j, k + 1) > vof_arr(i, j, k)) ? k + 1
-                                                                      : k;
-                        amrex::Real dir =
-                            (vof_arr(i, j, k + 1) > vof_arr(i, j, k)) ? -1 : 1;
-                        const amrex::Real zl =
-                            probloz + (kk + dir * 0.5 * vof_arr(i, j, k)) * dz;
-                        Wave_Energy_Fab += cell_vol * mask_arr(i, j, k) *
-                                           vof_arr(i, j, k) * g * zl;
-                    });
-                return Wave_Energy_Fab;
-            });
-    }
-
-    amrex::ParallelDescriptor::ReduceRealSum(wave_pe);
-
-    return wave_pe;
+    return m_sim.post_manager().reductions().value(m_pe_qid);
 }
 
 void WaveEnergy::post_advance_work()
@@ -4,6 +4,7 @@
 #include "amr-wind/wind_energy/actuator/ActuatorContainer.H"
 #include "amr-wind/CFDSim.H"
 #include "amr-wind/core/FieldRepo.H"
+#include "amr-wind/utilities/PerfMonitor.H"
 
 #include <algorithm>
 #include <memory>
@@ -89,6 +90,11 @@ void Actuator::pre_advance_work()
 
     m_container->reset_container();
     update_positions();
+    if (m_sim.perf_monitor().enabled()) {
+        m_sim.perf_monitor().add(
+            PerfMonitor::Counter::Particles,
+            m_container->TotalNumberOfParticles(true, true));
+    }
     update_velocities();
     compute_forces();
     compute_source_term();
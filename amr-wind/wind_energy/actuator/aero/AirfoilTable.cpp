@@ -1,11 +1,108 @@
 #include "amr-wind/wind_energy/actuator/aero/AirfoilTable.H"
 #include "amr-wind/utilities/linear_interpolation.H"
 
+#include "AMReX_ParallelDescriptor.H"
+
 #include <fstream>
 #include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <sstream>
 
 namespace amr_wind::actuator {
 
+namespace {
+
+//! Identifier at the start of the binary airfoil cache files
+constexpr char cache_magic[] = "AWAIRFOIL1";
+
+//! Serialized airfoil tables loaded by AirfoilLoader::load_airfoil
+std::map<std::string, amrex::Vector<amrex::Real>>& airfoil_cache()
+{
+    static std::map<std::string, amrex::Vector<amrex::Real>> cache;
+    return cache;
+}
+
+//! 64-bit FNV-1a hash used to detect stale cache files
+std::uint64_t fnv1a_hash(const std::string& str)
+{
+    std::uint64_t hash = 14695981039346656037ULL;
+    for (const char ch : str) {
+        hash ^= static_cast<unsigned char>(ch);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+void serialize(const AirfoilTable& af, amrex::Vector<amrex::Real>& buf)
+{
+    const int num_entries = af.num_entries();
+    buf.resize(1 + num_entries * (1 + AMREX_SPACEDIM));
+    buf[0] = static_cast<amrex::Real>(num_entries);
+    for (int i = 0; i < num_entries; ++i) {
+        buf[1 + i] = af.aoa()[i];
+        for (int n = 0; n < AMREX_SPACEDIM; ++n) {
+            buf[1 + num_entries + i * AMREX_SPACEDIM + n] = af.polars()[i][n];
+        }
+    }
+}
+
+bool read_binary_cache(
+    const std::string& fname,
+    const std::uint64_t hash,
+    amrex::Vector<amrex::Real>& buf)
+{
+    std::ifstream fh(fname, std::ios::in | std::ios::binary);
+    if (!fh.good()) {
+        return false;
+    }
+
+    char magic[sizeof(cache_magic)]{};
+    std::uint64_t fhash = 0;
+    std::uint64_t bufsize = 0;
+    fh.read(magic, sizeof(cache_magic) - 1);
+    fh.read(reinterpret_cast<char*>(&fhash), sizeof(fhash));
+    fh.read(reinterpret_cast<char*>(&bufsize), sizeof(bufsize));
+    if (!fh.good() || (std::string(magic) != cache_magic) || (fhash != hash)) {
+        return false;
+    }
+
+    buf.resize(bufsize);
+    fh.read(
+        reinterpret_cast<char*>(buf.data()),
+        static_cast<std::streamsize>(bufsize * sizeof(amrex::Real)));
+    return fh.good() && (bufsize > 0) &&
+           (static_cast<std::uint64_t>(buf.size()) ==
+            1 + static_cast<std::uint64_t>(buf[0]) * (1 + AMREX_SPACEDIM));
+}
+
+void write_binary_cache(
+    const std::string& fname,
+    const std::uint64_t hash,
+    const amrex::Vector<amrex::Real>& buf)
+{
+    std::ofstream fh(
+        fname, std::ios::out | std::ios::trunc | std::ios::binary);
+    if (!fh.good()) {
+        amrex::Warning(
+            "AirfoilLoader: Cannot write airfoil cache file: " + fname);
+        return;
+    }
+
+    const auto bufsize = static_cast<std::uint64_t>(buf.size());
+    fh.write(cache_magic, sizeof(cache_magic) - 1);
+    fh.write(reinterpret_cast<const char*>(&hash), sizeof(hash));
+    fh.write(reinterpret_cast<const char*>(&bufsize), sizeof(bufsize));
+    fh.write(
+        reinterpret_cast<const char*>(buf.data()),
+        static_cast<std::streamsize>(bufsize * sizeof(amrex::Real)));
+}
+
+} // namespace
+
 AirfoilTable::AirfoilTable(const int num_entries)
     : m_aoa(num_entries), m_polar(num_entries)
 {}
@@ -15,8 +112,11 @@ AirfoilTable::~AirfoilTable() = default;
 void AirfoilTable::operator()(
     const amrex::Real aoa, amrex::Real& cl, amrex::Real& cd) const
 {
-    namespace interp = ::amr_wind::interp;
-    vs::Vector polar = interp::linear(m_aoa, m_polar, aoa);
+    if (m_uniform_exact) {
+        host_view()(aoa, cl, cd);
+        return;
+    }
+    const auto polar = interp::linear(m_aoa, m_polar, aoa);
     cl = polar.x();
     cd = polar.y();
 }
@@ -27,8 +127,11 @@ void AirfoilTable::operator()(
     amrex::Real& cd,
     amrex::Real& cm) const
 {
-    namespace interp = ::amr_wind::interp;
-    vs::Vector polar = interp::linear(m_aoa, m_polar, aoa);
+    if (m_uniform_exact) {
+        host_view()(aoa, cl, cd, cm);
+        return;
+    }
+    const auto polar = interp::linear(m_aoa, m_polar, aoa);
     cl = polar.x();
     cd = polar.y();
     cm = polar.z();
@@ -48,6 +151,80 @@ void AirfoilTable::convert_aoa_to_radians()
         [](amrex::Real aoa_in) { return utils::radians(aoa_in); });
 }
 
+void AirfoilTable::build_uniform_table()
+{
+    const int num_entries = static_cast<int>(m_aoa.size());
+    if (num_entries < 1) {
+        amrex::Abort("AirfoilTable: Airfoil table is empty");
+    }
+    if (num_entries < 2) {
+        m_uniform_polar.assign(2, m_polar[0]);
+        m_uniform_aoa_min = m_aoa[0];
+        m_uniform_inv_daoa = 0.0;
+        m_uniform_exact = true;
+    } else {
+        amrex::Real dmin = std::numeric_limits<amrex::Real>::max();
+        for (int i = 1; i < num_entries; ++i) {
+            dmin = amrex::min(dmin, m_aoa[i] - m_aoa[i - 1]);
+        }
+        if (!(dmin > 0.0)) {
+            amrex::Abort(
+                "AirfoilTable: Angles of attack must be strictly increasing");
+        }
+
+        // Use the coarsest spacing such that every input entry lies on the
+        // uniform grid, so that the uniform table interpolates exactly like
+        // the input table. Otherwise, keep the finest candidate for the device
+        // lookups, which are then approximate, and interpolate the input table
+        // directly on the host.
+        constexpr int max_refinement = 8;
+        constexpr amrex::Real max_intervals = (1 << 16) - 1;
+        constexpr amrex::Real align_tol = 1.0e-6;
+        const amrex::Real range = m_aoa.back() - m_aoa.front();
+        int num_intervals = 0;
+        bool aligned = false;
+        for (int nref = 1; (nref <= max_refinement) && !aligned; ++nref) {
+            const amrex::Real nint = std::round(range * nref / dmin);
+            if (nint > max_intervals) {
+                num_intervals = static_cast<int>(max_intervals);
+                break;
+            }
+            num_intervals = static_cast<int>(nint);
+            const amrex::Real daoa = range / num_intervals;
+            aligned = true;
+            for (int i = 1; (i < num_entries - 1) && aligned; ++i) {
+                const amrex::Real xi = (m_aoa[i] - m_aoa[0]) / daoa;
+                aligned = std::abs(xi - std::round(xi)) < align_tol;
+            }
+        }
+        m_uniform_exact = aligned;
+        if (!aligned) {
+            amrex::Print()
+                << "WARNING: AirfoilTable: Angles of attack do not lie on a "
+                   "uniform grid; the device lookups use an approximate table "
+                   "with "
+                << num_intervals + 1 << " entries" << std::endl;
+        }
+
+        const amrex::Real daoa = range / num_intervals;
+        m_uniform_aoa_min = m_aoa[0];
+        m_uniform_inv_daoa = 1.0 / daoa;
+        m_uniform_polar.resize(num_intervals + 1);
+        for (int i = 0; i <= num_intervals; ++i) {
+            m_uniform_polar[i] =
+                interp::linear(m_aoa, m_polar, m_aoa[0] + i * daoa);
+        }
+        // Use the input values at the ends to avoid roundoff in the grid
+        m_uniform_polar.front() = m_polar.front();
+        m_uniform_polar.back() = m_polar.back();
+    }
+
+    m_uniform_polar_d.resize(m_uniform_polar.size());
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, m_uniform_polar.begin(),
+        m_uniform_polar.end(), m_uniform_polar_d.begin());
+}
+
 std::unique_ptr<AirfoilTable>
 AirfoilLoader::load_text_file(const std::string& af_file)
 {
@@ -70,21 +247,75 @@ AirfoilLoader::load_openfast_airfoil(const std::string& af_file)
     return load_openfast_airfoil(afh);
 }
 
-std::unique_ptr<AirfoilTable>
-AirfoilLoader::load_airfoil(const std::string& af_file, const std::string& type)
+std::unique_ptr<AirfoilTable> AirfoilLoader::load_airfoil(
+    const std::string& af_file,
+    const std::string& type,
+    const bool use_binary_cache)
 {
+    BL_PROFILE("amr-wind::actuator::AirfoilLoader::load_airfoil");
     const std::string& aftype = amrex::toLower(type);
-
-    std::unique_ptr<AirfoilTable> af;
-    if (aftype == "openfast") {
-        af = load_openfast_airfoil(af_file);
-    } else if (aftype == "text") {
-        af = load_text_file(af_file);
-    } else {
+    if ((aftype != "openfast") && (aftype != "text")) {
         amrex::Abort("Invalid airfoil type specified");
     }
 
-    return af;
+    auto& cache = airfoil_cache();
+    const std::string key = aftype + ":" + af_file;
+    auto found = cache.find(key);
+    if (found == cache.end()) {
+        // Table serialized as the number of entries followed by the angles of
+        // attack and the polars
+        amrex::Vector<amrex::Real> buf;
+        if (amrex::ParallelDescriptor::IOProcessor()) {
+            std::ifstream afh(af_file, std::ios::in | std::ios::binary);
+            if (!afh.good()) {
+                amrex::Abort(
+                    "AirfoilLoader: Cannot open airfoil file: " + af_file);
+            }
+            const std::string contents(
+                (std::istreambuf_iterator<char>(afh)),
+                std::istreambuf_iterator<char>());
+            const auto hash = fnv1a_hash(contents);
+            const std::string cache_file = af_file + ".awbin";
+            const bool has_cache =
+                use_binary_cache && read_binary_cache(cache_file, hash, buf);
+            if (!has_cache) {
+                std::istringstream iss(contents);
+                auto af = (aftype == "openfast") ? load_openfast_airfoil(iss)
+                                                 : load_text_file(iss);
+                serialize(*af, buf);
+                if (use_binary_cache) {
+                    write_binary_cache(cache_file, hash, buf);
+                }
+            }
+        }
+
+        int bufsize = static_cast<int>(buf.size());
+        const int ioproc = amrex::ParallelDescriptor::IOProcessorNumber();
+        amrex::ParallelDescriptor::Bcast(&bufsize, 1, ioproc);
+        buf.resize(bufsize);
+        amrex::ParallelDescriptor::Bcast(buf.data(), bufsize, ioproc);
+        found = cache.emplace(key, std::move(buf)).first;
+    }
+
+    const auto& data = found->second;
+    const int num_entries = static_cast<int>(data[0]);
+    std::unique_ptr<AirfoilTable> aftab(new AirfoilTable(num_entries));
+    for (int i = 0; i < num_entries; ++i) {
+        aftab->m_aoa[i] = data[1 + i];
+        for (int n = 0; n < AMREX_SPACEDIM; ++n) {
+            aftab->m_polar[i][n] =
+                data[1 + num_entries + i * AMREX_SPACEDIM + n];
+        }
+    }
+    aftab->build_uniform_table();
+    return aftab;
+}
+
+int AirfoilLoader::num_cached_airfoils()
+{
+    return static_cast<int>(airfoil_cache().size());
 }
 
+void AirfoilLoader::clear_cache() { airfoil_cache().clear(); }
+
 } // namespace amr_wind::actuator
@@ -196,6 +196,7 @@ void optional_parameters(DiskBaseData& meta, const utils::ActParser& pp)
     pp.query("disk_normal", meta.normal_vec);
     pp.query("diameters_to_sample", meta.diameters_to_sample);
     pp.query("num_points_t", meta.num_force_theta_pts);
+    pp.query("cache_spreading", meta.cache_spreading);
 
     // make sure we compute normal vec contribution from tilt before yaw
     // since we won't know a reference axis to rotate for tilt after
@@ -0,0 +1,172 @@
+#!/usr/bin/env python3
+
+# ================================================================================
+#
+# Imports
+#
+# ================================================================================
+import argparse
+import json
+import re
+import statistics
+import sys
+
+# Per-step timing lines printed by incflo::Evolve
+WALLCLOCK_RE = re.compile(
+    r"^WallClockTime:\s+(\d+)\s+Pre:\s+(\S+)\s+Solve:\s+(\S+)"
+    r"\s+Post:\s+(\S+)\s+Total:\s+(\S+)"
+)
+SOLVE_PER_CELL_RE = re.compile(r"^Solve time per cell:\s+(\S+)")
+
+
+# ================================================================================
+#
+# Functions
+#
+# ================================================================================
+def parse_steps(lines, skip_steps):
+    """Return the per-step timings, skipping the warm-up steps"""
+    steps = {"pre": [], "solve": [], "post": [], "total": [], "solve_per_cell": []}
+    step = 0
+    for line in lines:
+        match = WALLCLOCK_RE.match(line)
+        if match:
+            step = int(match.group(1))
+            if step > skip_steps:
+                for key, val in zip(
+                    ["pre", "solve", "post", "total"], match.groups()[1:]
+                ):
+                    steps[key].append(float(val))
+            continue
+        match = SOLVE_PER_CELL_RE.match(line)
+        if match and step > skip_steps:
+            steps["solve_per_cell"].append(float(match.group(1)))
+    return steps
+
+
+def parse_tiny_profiler(lines):
+    """Return the maximum inclusive time of each TinyProfiler region"""
+    regions = {}
+    in_table = False
+    num_dashes = 0
+    for line in lines:
+        if line.startswith("Name") and "Incl. Max" in line:
+            in_table = True
+            num_dashes = 0
+            continue
+        if not in_table:
+            continue
+        if line.startswith("---"):
+            # The table rows are enclosed between two dashed lines
+            num_dashes += 1
+            if num_dashes > 1:
+                in_table = False
+            continue
+        tokens = line.split()
+        if len(tokens) < 6:
+            continue
+        # Columns: Name NCalls Incl. Min Incl. Avg Incl. Max Max %
+        name = " ".join(tokens[:-5])
+        regions[name] = float(tokens[-2])
+    return regions
+
+
+def measure(fname, skip_steps):
+    """Collect the metrics from a log file"""
+    with open(fname, "r") as fh:
+        lines = [line.strip() for line in fh]
+
+    steps = parse_steps(lines, skip_steps)
+    if not steps["total"]:
+        sys.exit(f"No timesteps found in {fname} after {skip_steps} warm-up steps")
+
+    # Medians are robust to the occasional slow step (I/O, system noise)
+    metrics = {
+        f"step_{key}": statistics.median(vals) for key, vals in steps.items() if vals
+    }
+    for name, val in parse_tiny_profiler(lines).items():
+        metrics[f"region::{name}"] = val
+    return metrics
+
+
+def compare(metrics, baseline, tol, regions):
+    """Return the list of metrics that are slower than the baseline"""
+    # The pre- and post-processing times are too short to be compared reliably
+    keys = [
+        k for k in ["step_total", "step_solve", "step_solve_per_cell"] if k in baseline
+    ]
+    keys += [f"region::{r}" for r in regions if f"region::{r}" in baseline]
+
+    failures = []
+    print(f"{'metric':<60} {'baseline':>12} {'current':>12} {'ratio':>8}")
+    for key in keys:
+        if key not in metrics:
+            print(f"{key:<60} {baseline[key]:12.4e} {'missing':>12}")
+            continue
+        ratio = metrics[key] / baseline[key] if baseline[key] > 0.0 else 1.0
+        status = ""
+        if ratio > 1.0 + tol:
+            status = "  SLOWER"
+            failures.append(key)
+        elif ratio < 1.0 - tol:
+            status = "  faster"
+        print(
+            f"{key:<60} {baseline[key]:12.4e} {metrics[key]:12.4e} "
+            f"{ratio:8.3f}{status}"
+        )
+    return failures
+
+
+# ================================================================================
+#
+# Main
+#
+# ================================================================================
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(
+        description="Compare benchmark timings against a baseline"
+    )
+    parser.add_argument("-l", "--log", help="Log file", type=str, required=True)
+    parser.add_argument(
+        "-o", "--output", help="Measured timings (JSON)", type=str, required=True
+    )
+    parser.add_argument(
+        "-b", "--baseline", help="Baseline timings (JSON)", type=str, default=""
+    )
+    parser.add_argument(
+        "-t", "--tol", help="Relative tolerance", type=float, default=0.1
+    )
+    parser.add_argument(
+        "-s", "--skip-steps", help="Number of warm-up steps", type=int, default=2
+    )
+    parser.add_argument(
+        "-r",
+        "--regions",
+        help="TinyProfiler regions to compare",
+        nargs="*",
+        default=[
+            "amr-wind::incflo::ApplyPredictor",
+            "amr-wind::incflo::ApplyCorrector",
+            "amr-wind::incflo::ApplyProjection",
+            "amr-wind::fvm::gradient",
+            "amr-wind::fvm::strainrate",
+        ],
+    )
+    args = parser.parse_args()
+
+    metrics = measure(args.log, args.skip_steps)
+    with open(args.output, "w") as fh:
+        json.dump(metrics, fh, indent=2, sort_keys=True)
+
+    if not args.baseline:
+        for key, val in sorted(metrics.items()):
+            print(f"{key:<60} {val:12.4e}")
+        sys.exit(0)
+
+    with open(args.baseline, "r") as fh:
+        baseline = json.load(fh)
+    failures = compare(metrics, baseline, args.tol, args.regions)
+    if failures:
+        sys.exit(
+            f"Performance regression (tolerance = {args.tol}): " + ", ".join(failures)
+        )
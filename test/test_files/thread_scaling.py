@@ -0,0 +1,115 @@
+#!/usr/bin/env python3
+
+# ================================================================================
+#
+# Imports
+#
+# ================================================================================
+import argparse
+import json
+import re
+import sys
+
+from perf_compare import measure
+
+# Thread count encoded in the log file names, e.g., abl_godunov_t8.log
+NTHREADS_RE = re.compile(r"_t(\d+)\.log$")
+
+
+# ================================================================================
+#
+# Functions
+#
+# ================================================================================
+def num_threads(fname):
+    """Return the number of threads of a run from its log file name"""
+    match = NTHREADS_RE.search(fname)
+    if not match:
+        sys.exit(f"Cannot determine the number of threads of {fname}")
+    return int(match.group(1))
+
+
+def scaling(runs, patterns):
+    """Return the speedup and efficiency of each metric relative to one thread"""
+    nthreads = sorted(runs)
+    base = runs[nthreads[0]]
+    regions = sorted(k for k in base if k.startswith("region::"))
+    missing = [p for p in patterns if not any(p in k for k in regions)]
+    if missing:
+        sys.exit(
+            f"TinyProfiler regions matching {missing} not found; "
+            "build with AMR_WIND_ENABLE_TINY_PROFILE=ON"
+        )
+    keys = ["step_total"]
+    keys += [k for k in regions if any(p in k for p in patterns)]
+
+    results = {}
+    for key in keys:
+        if base.get(key, 0.0) <= 0.0:
+            continue
+        entries = {}
+        for n in nthreads:
+            if key not in runs[n] or runs[n][key] <= 0.0:
+                continue
+            speedup = base[key] / runs[n][key]
+            entries[str(n)] = {
+                "time": runs[n][key],
+                "speedup": speedup,
+                "efficiency": speedup * nthreads[0] / n,
+            }
+        results[key] = entries
+    return results
+
+
+# ================================================================================
+#
+# Main
+#
+# ================================================================================
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(
+        description="Compute the thread scaling of benchmark timings"
+    )
+    parser.add_argument(
+        "-l",
+        "--logs",
+        help="Log files, one per thread count (<name>_t<nthreads>.log)",
+        nargs="+",
+        required=True,
+    )
+    parser.add_argument(
+        "-o", "--output", help="Scaling results (JSON)", type=str, required=True
+    )
+    parser.add_argument(
+        "-s", "--skip-steps", help="Number of warm-up steps", type=int, default=2
+    )
+    parser.add_argument(
+        "-r",
+        "--regions",
+        help="Substrings of the TinyProfiler regions to report",
+        nargs="*",
+        default=[
+            "update_turbulent_viscosity",
+            "update_scalar_diff",
+            "update_relaxation_zones",
+            "update_velocities",
+            "set_density_via",
+            "create_map",
+            "ApplyPredictor",
+            "ApplyCorrector",
+        ],
+    )
+    args = parser.parse_args()
+
+    runs = {num_threads(fname): measure(fname, args.skip_steps) for fname in args.logs}
+    results = scaling(runs, args.regions)
+    with open(args.output, "w") as fh:
+        json.dump(results, fh, indent=2, sort_keys=True)
+
+    print(f"{'metric':<60} {'threads':>8} {'speedup':>8} {'efficiency':>10}")
+    for key, entries in results.items():
+        for n, vals in sorted(entries.items(), key=lambda x: int(x[0])):
+            print(
+                f"{key:<60} {n:>8} {vals['speedup']:8.2f} "
+                f"{vals['efficiency']:10.2f}"
+            )
@@ -0,0 +1,199 @@
+/** Microbenchmark of the Godunov flux computation
+ *
+ *  Measures the throughput (cells per second) of godunov::compute_fluxes on a
+ *  single box for the schemes implemented in AMR-Wind, with and without the
+ *  cache-blocked tiling of godunov::compute_fluxes_tiled. Inputs are read from
+ *  the command line or an input file:
+ *
+ *    bench.n_cell    = 64 64 64   # Box size
+ *    bench.ncomp     = 3          # Number of transported components
+ *    bench.tile_size = 32 8 8     # Tile size for the blocked variant
+ *    bench.num_iters = 10         # Number of timed iterations per scheme
+ *    bench.schemes   = ppm_nolim minmod weno_js weno_z
+ */
+
+#include "amr-wind/convection/Godunov.H"
+#include "amr-wind/utilities/console_io.H"
+#include "amr-wind/utilities/trig_ops.H"
+
+#include "AMReX.H"
+#include "AMReX_FArrayBox.H"
+#include "AMReX_Geometry.H"
+#include "AMReX_ParmParse.H"
+
+#include <iomanip>
+#include <map>
+
+namespace {
+
+struct BenchData
+{
+    BenchData(const amrex::Box& bx_in, const int ncomp_in)
+        : bx(bx_in)
+        , ncomp(ncomp_in)
+        , q(amrex::grow(bx_in, 3), ncomp_in)
+        , fq(amrex::grow(bx_in, 1), ncomp_in)
+        , bcrec(ncomp_in)
+        , iconserv(ncomp_in, 1)
+    {
+        const amrex::RealBox rb(0.0, 0.0, 0.0, 1.0, 1.0, 1.0);
+        const amrex::Array<int, AMREX_SPACEDIM> is_periodic{1, 1, 1};
+        geom.emplace_back(bx_in, rb, 0, is_periodic);
+        const auto dx = geom[0].CellSizeArray();
+        dt = 0.2 * dx[0];
+
+        const auto& qarr = q.array();
+        amrex::ParallelFor(
+            q.box(), ncomp,
+            [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
+                constexpr amrex::Real twopi = amr_wind::utils::two_pi();
+                const amrex::Real x = (i + 0.5) * dx[0];
+                const amrex::Real y = (j + 0.5) * dx[1];
+                const amrex::Real z = (k + 0.5) * dx[2];
+                qarr(i, j, k, n) =
+                    std::sin(twopi * (x + n * y)) * std::cos(twopi * z);
+            });
+        fq.setVal<amrex::RunOn::Device>(0.0);
+
+        for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
+            umac[dir].resize(
+                amrex::grow(amrex::surroundingNodes(bx_in, dir), 2), 1);
+            const auto& uarr = umac[dir].array();
+            amrex::ParallelFor(
+                umac[dir].box(),
+                [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                    constexpr amrex::Real twopi = amr_wind::utils::two_pi();
+                    uarr(i, j, k) =
+                        std::cos(twopi * (i * dx[0] + j * dx[1] + k * dx[2]));
+                });
+            flux[dir].resize(amrex::surroundingNodes(bx_in, dir), ncomp);
+        }
+    }
+
+    void compute(const godunov::scheme scheme, const amrex::IntVect& tile_size)
+    {
+        godunov::compute_fluxes_tiled(
+            0, bx, ncomp, flux[0].array(), flux[1].array(), flux[2].array(),
+            q.const_array(), umac[0].const_array(), umac[1].const_array(),
+            umac[2].const_array(), fq.const_array(), bcrec.data(),
+            iconserv.data(), geom, dt, scheme, tile_size);
+    }
+
+    //! Return the cells per second for a given scheme and tile size
+    double run(
+        const godunov::scheme scheme,
+        const amrex::IntVect& tile_size,
+        const int num_iters)
+    {
+        // Warm up caches and memory arenas
+        compute(scheme, tile_size);
+        amrex::Gpu::streamSynchronize();
+
+        const double start = amrex::second();
+        for (int it = 0; it < num_iters; ++it) {
+            compute(scheme, tile_size);
+        }
+        amrex::Gpu::streamSynchronize();
+        const double elapsed = amrex::second() - start;
+        return static_cast<double>(bx.numPts()) * num_iters / elapsed;
+    }
+
+    amrex::Box bx;
+    int ncomp;
+    amrex::Vector<amrex::Geometry> geom;
+    amrex::Real dt{0.0};
+    amrex::FArrayBox q;
+    amrex::FArrayBox fq;
+    amrex::Array<amrex::FArrayBox, AMREX_SPACEDIM> umac;
+    amrex::Array<amrex::FArrayBox, AMREX_SPACEDIM> flux;
+    amrex::Gpu::DeviceVector<amrex::BCRec> bcrec;
+    amrex::Gpu::DeviceVector<int> iconserv;
+};
+
+void run_benchmark()
+{
+    BL_PROFILE("godunov-bench::run_benchmark");
+    amrex::Vector<int> n_cell{{64, 64, 64}};
+    amrex::Vector<int> tile_size{{32, 8, 8}};
+    int ncomp = 3;
+    int num_iters = 10;
+    amrex::Vector<std::string> schemes{
+        {"ppm_nolim", "minmod", "weno_js", "weno_z"}};
+    {
+        amrex::ParmParse pp("bench");
+        pp.queryarr("n_cell", n_cell);
+        pp.queryarr("tile_size", tile_size);
+        pp.query("ncomp", ncomp);
+        pp.query("num_iters", num_iters);
+        pp.queryarr("schemes", schemes);
+    }
+    AMREX_ALWAYS_ASSERT(n_cell.size() == AMREX_SPACEDIM);
+    AMREX_ALWAYS_ASSERT(tile_size.size() == AMREX_SPACEDIM);
+
+    const std::map<std::string, godunov::scheme> scheme_map{
+        {"ppm_nolim", godunov::scheme::PPM_NOLIM},
+        {"minmod", godunov::scheme::MINMOD},
+        {"upwind", godunov::scheme::UPWIND},
+        {"weno_js", godunov::scheme::WENOJS},
+        {"weno_z", godunov::scheme::WENOZ}};
+
+    const amrex::Box bx(
+        amrex::IntVect(0), amrex::IntVect(n_cell) - amrex::IntVect(1));
+    const amrex::IntVect tsize(tile_size);
+    BenchData data(bx, ncomp);
+
+    amrex::Print() << "Godunov flux benchmark: box = " << bx.length()
+                   << ", ncomp = " << ncomp << ", tile = " << tsize
+                   << ", iterations = " << num_iters << std::endl
+                   << std::setw(12) << std::left << "scheme" << std::setw(18)
+                   << std::right << "untiled [cell/s]" << std::setw(18)
+                   << "tiled [cell/s]" << std::setw(10) << "speedup"
+                   << std::endl;
+    for (const auto& name : schemes) {
+        const auto found = scheme_map.find(amrex::toLower(name));
+        if (found == scheme_map.end()) {
+            amrex::Abort(
+                "godunov-bench: invalid scheme " + name +
+                "; the limited PPM, PLM and BDS schemes are provided by "
+                "AMReX-Hydro and are not benchmarked");
+        }
+        const double base =
+            data.run(found->second, amrex::IntVect(0), num_iters);
+        const double tiled = data.run(found->second, tsize, num_iters);
+        amrex::Print() << std::setw(12) << std::left << name << std::right
+                       << std::scientific << std::setprecision(4)
+                       << std::setw(18) << base << std::setw(18) << tiled
+                       << std::fixed << std::setprecision(2) << std::setw(10)
+                       << tiled / base << std::endl;
+    }
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+#ifdef AMREX_USE_MPI
+    MPI_Init(&argc, &argv);
+#endif
+
+    amr_wind::io::print_banner(MPI_COMM_WORLD, std::cout);
+
+    amrex::Initialize(argc, argv, true, MPI_COMM_WORLD, []() {
+        amrex::ParmParse pp("amrex");
+        // Set the defaults so that we throw an exception instead of attempting
+        // to generate backtrace files. However, if the user has explicitly set
+        // these options in their input files respect those settings.
+        if (!pp.contains("throw_exception")) pp.add("throw_exception", 1);
+        if (!pp.contains("signal_handling")) pp.add("signal_handling", 0);
+    });
+
+    run_benchmark();
+
+    amrex::Finalize();
+
+#ifdef AMREX_USE_MPI
+    MPI_Finalize();
+#endif
+
+    return 0;
+}
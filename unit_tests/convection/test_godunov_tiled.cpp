@@ -0,0 +1,111 @@
+#include "aw_test_utils/AmrexTest.H"
+
+#include "amr-wind/convection/Godunov.H"
+#include "amr-wind/utilities/trig_ops.H"
+#include "AMReX_FArrayBox.H"
+#include "AMReX_Geometry.H"
+
+namespace amr_wind_tests {
+
+namespace {
+
+void init_state(
+    const amrex::Box& bx,
+    const int ncomp,
+    const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM>& dx,
+    const amrex::Array4<amrex::Real>& q)
+{
+    amrex::ParallelFor(
+        bx, ncomp, [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
+            const amrex::Real x = (i + 0.5) * dx[0];
+            const amrex::Real y = (j + 0.5) * dx[1];
+            const amrex::Real z = (k + 0.5) * dx[2];
+            constexpr amrex::Real twopi = amr_wind::utils::two_pi();
+            // Sharp features exercise the limiters of the schemes
+            q(i, j, k, n) = std::sin(twopi * (x + n * y)) *
+                                std::cos(twopi * z) +
+                            ((x > 0.5) ? 1.0 : 0.0);
+        });
+}
+
+void init_velocity(
+    const amrex::Box& bx,
+    const int dir,
+    const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM>& dx,
+    const amrex::Array4<amrex::Real>& vel)
+{
+    amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+        const amrex::Real x = i * dx[0];
+        const amrex::Real y = j * dx[1];
+        const amrex::Real z = k * dx[2];
+        constexpr amrex::Real twopi = amr_wind::utils::two_pi();
+        vel(i, j, k) = std::cos(twopi * (x + y + z)) + 0.3 * (dir - 1);
+    });
+}
+
+} // namespace
+
+class GodunovTiledTest : public AmrexTest
+{};
+
+TEST_F(GodunovTiledTest, bit_identical_fluxes)
+{
+    constexpr int ncomp = 2;
+    const amrex::Box domain(amrex::IntVect(0), amrex::IntVect(23, 19, 17));
+    const amrex::RealBox rb(0.0, 0.0, 0.0, 1.0, 1.0, 1.0);
+    const amrex::Array<int, AMREX_SPACEDIM> is_periodic{1, 1, 1};
+    amrex::Vector<amrex::Geometry> geom{
+        amrex::Geometry(domain, rb, 0, is_periodic)};
+    const auto dx = geom[0].CellSizeArray();
+    const amrex::Real dt = 0.2 * dx[0];
+
+    // Box that is not a multiple of the tile size
+    const amrex::Box bx(amrex::IntVect(2, 1, 3), amrex::IntVect(20, 17, 15));
+    amrex::FArrayBox qfab(amrex::grow(bx, 3), ncomp);
+    amrex::FArrayBox fqfab(amrex::grow(bx, 1), ncomp);
+    init_state(qfab.box(), ncomp, dx, qfab.array());
+    fqfab.setVal<amrex::RunOn::Device>(0.1);
+
+    amrex::Vector<amrex::FArrayBox> umac(AMREX_SPACEDIM);
+    for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
+        umac[dir].resize(amrex::grow(amrex::surroundingNodes(bx, dir), 2), 1);
+        init_velocity(umac[dir].box(), dir, dx, umac[dir].array());
+    }
+
+    amrex::Gpu::DeviceVector<amrex::BCRec> bcrec(ncomp);
+    amrex::Gpu::DeviceVector<int> iconserv(ncomp, 1);
+
+    const amrex::Vector<godunov::scheme> schemes{
+        godunov::scheme::PPM_NOLIM, godunov::scheme::MINMOD,
+        godunov::scheme::WENOJS, godunov::scheme::WENOZ};
+    for (const auto scheme : schemes) {
+        amrex::Vector<amrex::FArrayBox> ref(AMREX_SPACEDIM);
+        amrex::Vector<amrex::FArrayBox> tiled(AMREX_SPACEDIM);
+        for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
+            ref[dir].resize(amrex::surroundingNodes(bx, dir), ncomp);
+            tiled[dir].resize(amrex::surroundingNodes(bx, dir), ncomp);
+            ref[dir].setVal<amrex::RunOn::Device>(0.0);
+            tiled[dir].setVal<amrex::RunOn::Device>(0.0);
+        }
+
+        const auto compute = [&](amrex::Vector<amrex::FArrayBox>& flux,
+                                 const amrex::IntVect& tile_size) {
+            godunov::compute_fluxes_tiled(
+                0, bx, ncomp, flux[0].array(), flux[1].array(),
+                flux[2].array(), qfab.const_array(), umac[0].const_array(),
+                umac[1].const_array(), umac[2].const_array(),
+                fqfab.const_array(), bcrec.data(), iconserv.data(), geom, dt,
+                scheme, tile_size);
+        };
+        compute(ref, amrex::IntVect(0));
+        compute(tiled, amrex::IntVect(8, 4, 5));
+        amrex::Gpu::streamSynchronize();
+
+        for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
+            tiled[dir].minus<amrex::RunOn::Device>(ref[dir]);
+            EXPECT_EQ(tiled[dir].maxabs<amrex::RunOn::Device>(), 0.0);
+        }
+    }
+}
+
+} // namespace amr_wind_tests
@@ -1,4 +1,5 @@
 #include "aw_test_utils/MeshTest.H"
+#include "aw_test_utils/iter_tools.H"
 #include "amr-wind/core/field_ops.H"
 
 namespace amr_wind_tests {
@@ -279,6 +280,61 @@ TEST_F(FieldRepoTest, field_create_state)
     density.advance_states();
 }
 
+TEST_F(FieldRepoTest, field_lazy_allocation)
+{
+    populate_parameters();
+    create_mesh_instance();
+
+    auto& frepo = mesh().field_repo();
+    frepo.set_lazy_allocation(true);
+    auto& vel = frepo.declare_field("vel", 3, 1, 2);
+    auto& conv = frepo.declare_field("conv_term", 3, 0, 2);
+    vel.fillpatch_on_regrid() = true;
+    initialize_mesh();
+
+    // Fields interpolated on regrid are always allocated
+    auto& vel_old = vel.state(amr_wind::FieldState::Old);
+    auto& conv_old = conv.state(amr_wind::FieldState::Old);
+    const int nlevels = frepo.num_active_levels();
+    for (int lev = 0; lev < nlevels; ++lev) {
+        EXPECT_TRUE(vel.is_allocated(lev));
+        EXPECT_FALSE(vel_old.is_allocated(lev));
+        EXPECT_FALSE(conv.is_allocated(lev));
+        EXPECT_FALSE(conv_old.is_allocated(lev));
+        EXPECT_EQ(frepo.memory_usage(conv, lev), 0);
+    }
+
+    // Unused states remain unallocated when advancing states
+    frepo.advance_states();
+    for (int lev = 0; lev < nlevels; ++lev) {
+        EXPECT_TRUE(vel_old.is_allocated(lev));
+        EXPECT_FALSE(conv_old.is_allocated(lev));
+    }
+
+    // First access allocates and zero-initializes the data, including for
+    // fields declared after the mesh is created
+    auto& tracer = frepo.declare_field("tracer", 1, 2);
+    for (int lev = 0; lev < nlevels; ++lev) {
+        EXPECT_FALSE(tracer.is_allocated(lev));
+        EXPECT_EQ(conv(lev).nGrowVect(), conv.num_grow());
+        EXPECT_EQ(conv(lev).max(0), 0.0);
+        EXPECT_EQ(tracer(lev).nGrowVect(), tracer.num_grow());
+        EXPECT_TRUE(conv.is_allocated(lev));
+        EXPECT_TRUE(tracer.is_allocated(lev));
+
+        const auto& ba = tracer(lev).boxArray();
+        amrex::Long npts = 0;
+        for (int i = 0; i < static_cast<int>(ba.size()); ++i) {
+            npts += amrex::grow(ba[i], 2).numPts();
+        }
+        EXPECT_EQ(
+            frepo.memory_usage(tracer, lev),
+            npts * static_cast<amrex::Long>(sizeof(amrex::Real)));
+    }
+
+    frepo.print_memory_report();
+}
+
 TEST_F(FieldRepoTest, scratch_fields)
 {
     populate_parameters();
@@ -387,4 +443,70 @@ TEST_F(FieldRepoTest, field_subviews)
     }
 }
 
+TEST_F(FieldRepoTest, overlapped_fillpatch)
+{
+    initialize_mesh();
+    auto& repo = mesh().field_repo();
+
+    const amrex::Vector<std::string> names{"vel", "temp", "tracer"};
+    const amrex::Vector<int> ncomps{3, 1, 1};
+    amrex::Vector<amr_wind::Field*> fields;
+    amrex::Vector<amr_wind::Field*> ref_fields;
+    for (int i = 0; i < static_cast<int>(names.size()); ++i) {
+        for (const auto& name : {names[i], names[i] + "_ref"}) {
+            auto& fld = repo.declare_field(name, ncomps[i], 2);
+            fld.set_default_fillpatch_bc(sim().time());
+            run_algorithm(fld, [&](const int lev, const amrex::MFIter& mfi) {
+                const auto& bx = mfi.validbox();
+                const auto& farr = fld(lev).array(mfi);
+                const int nc = fld.num_comp();
+                const int fac = i + 1;
+                amrex::ParallelFor(
+                    bx, nc,
+                    [=] AMREX_GPU_DEVICE(int ii, int jj, int kk, int n) {
+                        farr(ii, jj, kk, n) =
+                            (ii + 2 * jj + 3 * kk) * (n + fac);
+                    });
+            });
+        }
+        fields.push_back(&repo.get_field(names[i]));
+        ref_fields.push_back(&repo.get_field(names[i] + "_ref"));
+    }
+
+    const int nlevels = repo.num_active_levels();
+    const amrex::Real time = sim().time().current_time();
+    repo.reset_fillpatch_stats();
+    repo.fillpatch_fields(ref_fields, time, false);
+    const auto ref_stats = repo.fillpatch_stats();
+    EXPECT_EQ(ref_stats.num_exchanges, 3 * nlevels);
+    EXPECT_EQ(ref_stats.num_overlapped, 0);
+
+    // Only the level 0 exchanges are overlapped, and every field still sends
+    // its own messages
+    repo.reset_fillpatch_stats();
+    repo.fillpatch_fields(fields, time);
+    const auto& stats = repo.fillpatch_stats();
+    EXPECT_EQ(stats.num_exchanges, 3 * nlevels);
+    EXPECT_EQ(stats.num_overlapped, 3);
+    EXPECT_EQ(stats.num_messages, ref_stats.num_messages);
+    EXPECT_EQ(stats.num_bytes, ref_stats.num_bytes);
+
+    // Fills of individual fields are also counted
+    fields[0]->fillpatch(time);
+    EXPECT_EQ(repo.fillpatch_stats().num_exchanges, 4 * nlevels);
+
+    // Ghost cells must be identical to the field-by-field fill
+    for (int i = 0; i < static_cast<int>(fields.size()); ++i) {
+        auto& fld = *fields[i];
+        auto& ref = *ref_fields[i];
+        for (int lev = 0; lev < nlevels; ++lev) {
+            amrex::MultiFab::Subtract(
+                ref(lev), fld(lev), 0, 0, fld.num_comp(), 2);
+            for (int n = 0; n < fld.num_comp(); ++n) {
+                EXPECT_EQ(ref(lev).norm0(n, 2), 0.0);
+            }
+        }
+    }
+}
+
 } // namespace amr_wind_tests
@@ -0,0 +1,153 @@
+#include <sstream>
+
+#include "aw_test_utils/MeshTest.H"
+#include "amr-wind/core/FineMaskCache.H"
+#include "amr-wind/utilities/tagging/CartBoxRefinement.H"
+
+namespace amr_wind_tests {
+
+namespace {
+
+int num_covered(const amrex::iMultiFab& mask)
+{
+    return amrex::ReduceSum(
+        mask, 0,
+        [=] AMREX_GPU_HOST_DEVICE(
+            amrex::Box const& bx, amrex::Array4<int const> const& marr) -> int {
+            int ncov = 0;
+            amrex::Loop(bx, [=, &ncov](int i, int j, int k) noexcept {
+                ncov += (marr(i, j, k) == 0) ? 1 : 0;
+            });
+            return ncov;
+        });
+}
+
+} // namespace
+
+class FineMaskCacheTest : public MeshTest
+{
+protected:
+    void populate_parameters() override
+    {
+        MeshTest::populate_parameters();
+
+        {
+            amrex::ParmParse pp("amr");
+            amrex::Vector<int> ncell{{nx, nx, nx}};
+            pp.add("max_level", 1);
+            pp.add("max_grid_size", nx / 2);
+            pp.add("blocking_factor", 4);
+            pp.addarr("n_cell", ncell);
+        }
+        {
+            amrex::ParmParse pp("geometry");
+            amrex::Vector<amrex::Real> problo{{0.0, 0.0, 0.0}};
+            amrex::Vector<amrex::Real> probhi{{16.0, 16.0, 16.0}};
+            pp.addarr("prob_lo", problo);
+            pp.addarr("prob_hi", probhi);
+        }
+    }
+
+    void create_refined_mesh()
+    {
+        populate_parameters();
+        std::stringstream ss;
+        ss << "1 // Number of levels" << std::endl;
+        ss << "1 // Number of boxes at this level" << std::endl;
+        ss << "2.0 4.0 6.0 10.0 12.0 14.0" << std::endl;
+
+        create_mesh_instance<RefineMesh>();
+        std::unique_ptr<amr_wind::CartBoxRefinement> box_refine(
+            new amr_wind::CartBoxRefinement(sim()));
+        box_refine->read_inputs(mesh(), ss);
+        mesh<RefineMesh>()->refine_criteria_vec().push_back(
+            std::move(box_refine));
+        initialize_mesh();
+    }
+
+    const int nx = 16;
+};
+
+TEST_F(FineMaskCacheTest, cell_mask)
+{
+    create_refined_mesh();
+    ASSERT_EQ(mesh().finestLevel(), 1);
+
+    auto& masks = sim().repo().fine_masks();
+    const auto cfba = amrex::coarsen(mesh().boxArray(1), mesh().refRatio(0));
+
+    const auto& mask0 = masks.cell_mask(0);
+    EXPECT_EQ(num_covered(mask0), cfba.numPts());
+    EXPECT_EQ(num_covered(masks.cell_mask(1)), 0);
+    EXPECT_EQ(masks.num_builds(), 2);
+
+    // The masks are reused until the grids change
+    EXPECT_EQ(&masks.cell_mask(0), &mask0);
+    EXPECT_EQ(masks.num_builds(), 2);
+
+    masks.invalidate();
+    masks.cell_mask(0);
+    EXPECT_EQ(masks.num_builds(), 3);
+}
+
+TEST_F(FineMaskCacheTest, node_mask)
+{
+    create_refined_mesh();
+    ASSERT_EQ(mesh().finestLevel(), 1);
+
+    auto& masks = sim().repo().fine_masks();
+    const auto& mask0 = masks.node_mask(0);
+    EXPECT_TRUE(mask0.boxArray().ixType().nodeCentered());
+
+    // Nodes inside or on the boundary of the fine level are covered
+    const auto nd_cfba = amrex::convert(
+        amrex::coarsen(mesh().boxArray(1), mesh().refRatio(0)),
+        amrex::IntVect::TheNodeVector());
+    int nexpected = 0;
+    for (amrex::MFIter mfi(mask0); mfi.isValid(); ++mfi) {
+        const auto& bx = mfi.validbox();
+        amrex::LoopOnCpu(bx, [&](int i, int j, int k) noexcept {
+            if (nd_cfba.contains(amrex::IntVect(i, j, k))) {
+                ++nexpected;
+            }
+        });
+    }
+    amrex::ParallelDescriptor::ReduceIntSum(nexpected);
+
+    EXPECT_GT(nexpected, 0);
+    EXPECT_EQ(num_covered(mask0), nexpected);
+    EXPECT_EQ(num_covered(masks.node_mask(1)), 0);
+}
+
+TEST_F(FineMaskCacheTest, uncovered_tiles)
+{
+    create_refined_mesh();
+    ASSERT_EQ(mesh().finestLevel(), 1);
+
+    auto& masks = sim().repo().fine_masks();
+    const auto cfba = amrex::coarsen(mesh().boxArray(1), mesh().refRatio(0));
+    const auto& tiles = masks.uncovered_tiles(0);
+
+    amrex::Long nuncovered = 0;
+    for (const auto& tile : tiles) {
+        amrex::Long ncov = 0;
+        for (const auto& isect : cfba.intersections(tile.box)) {
+            ncov += isect.second.numPts();
+        }
+        EXPECT_LT(ncov, tile.box.numPts());
+        EXPECT_EQ(tile.partially_covered, ncov > 0);
+        EXPECT_TRUE(mesh().boxArray(0)[tile.index].contains(tile.box));
+        nuncovered += tile.box.numPts() - ncov;
+    }
+    amrex::ParallelDescriptor::ReduceLongSum(nuncovered);
+
+    const amrex::Long ncells = mesh().boxArray(0).numPts();
+    EXPECT_EQ(nuncovered, ncells - cfba.numPts());
+
+    // All the tiles of the finest level are uncovered
+    for (const auto& tile : masks.uncovered_tiles(1)) {
+        EXPECT_FALSE(tile.partially_covered);
+    }
+}
+
+} // namespace amr_wind_tests
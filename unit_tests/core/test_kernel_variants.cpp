@@ -0,0 +1,26 @@
+#include "gtest/gtest.h"
+#include "amr-wind/core/kernel_variants.H"
+
+namespace amr_wind_tests {
+
+TEST(KernelVariants, dispatch_mesh_mapping)
+{
+    int ncalls = 0;
+    bool variant = false;
+    auto func = [&](auto mm) {
+        ++ncalls;
+        variant = decltype(mm)::value;
+    };
+
+    // The generic kernels are always used with mesh mapping
+    amr_wind::dispatch_mesh_mapping(true, func);
+    EXPECT_EQ(ncalls, 1);
+    EXPECT_TRUE(variant);
+
+    // The specialized kernels are used without mesh mapping, if available
+    amr_wind::dispatch_mesh_mapping(false, func);
+    EXPECT_EQ(ncalls, 2);
+    EXPECT_EQ(variant, !amr_wind::has_specialized_kernels());
+}
+
+} // namespace amr_wind_tests
@@ -5,8 +5,11 @@
 
 #include "aw_test_utils/AmrexTest.H"
 #include "AMReX_ParmParse.H"
+#include "AMReX_Utility.H"
 #include "amr-wind/core/SimTime.H"
 
+#include <fstream>
+
 namespace amr_wind_tests {
 
 namespace {
@@ -130,4 +133,80 @@ TEST_F(SimTimeTest, fixed_dt_loop)
     EXPECT_FALSE(time.write_last_plot_file());
 }
 
+TEST_F(SimTimeTest, output_triggers)
+{
+    build_simtime_params();
+    const std::string trigger_file = "simtime_test.checkpoint";
+    {
+        amrex::ParmParse pp("time");
+        pp.add("fixed_dt", 0.1);
+        pp.add("plot_interval", -1);
+        pp.add("checkpoint_interval", -1);
+        pp.add("plot_cfl_threshold", 0.5);
+        pp.add("checkpoint_trigger_file", trigger_file);
+    }
+    amr_wind::SimTime time;
+    time.parse_parameters();
+
+    // CFL at each timestep, crossing the threshold twice
+    const amrex::Vector<amrex::Real> cfl{
+        {0.2, 0.6, 0.7, 0.3, 0.8, 0.2, 0.2, 0.2, 0.2, 0.2}};
+    int counter = 0;
+    int plot_counter = 0;
+    int chkpt_counter = 0;
+    while (time.new_timestep()) {
+        time.set_current_cfl(cfl[counter] / time.deltaT(), 0.0, 0.0);
+        ++counter;
+
+        // Request a checkpoint through the sentinel file
+        if ((counter == 7) && amrex::ParallelDescriptor::IOProcessor()) {
+            std::ofstream fh(trigger_file);
+        }
+        time.update_output_triggers();
+
+        if (time.write_plot_file()) {
+            ++plot_counter;
+            EXPECT_TRUE((counter == 2) || (counter == 5));
+        }
+        if (time.write_checkpoint()) {
+            ++chkpt_counter;
+            EXPECT_EQ(counter, 7);
+        }
+    }
+    EXPECT_EQ(counter, 10);
+    EXPECT_EQ(plot_counter, 2);
+    EXPECT_EQ(chkpt_counter, 1);
+    EXPECT_FALSE(amrex::FileExists(trigger_file));
+}
+
+TEST_F(SimTimeTest, walltime_budget)
+{
+    build_simtime_params();
+    {
+        amrex::ParmParse pp("time");
+        pp.add("fixed_dt", 0.1);
+        pp.add("max_walltime", 1.0e-8);
+    }
+    amr_wind::SimTime time;
+    time.parse_parameters();
+
+    int counter = 0;
+    int chkpt_counter = 0;
+    while (time.new_timestep()) {
+        time.set_current_cfl(2.0, 0.0, 0.0);
+        ++counter;
+
+        time.update_output_triggers();
+        if (time.write_checkpoint()) {
+            ++chkpt_counter;
+        }
+    }
+
+    // The budget is exhausted after the first timestep, which is checkpointed
+    // even though it does not fall on the checkpoint interval
+    EXPECT_EQ(counter, 1);
+    EXPECT_EQ(chkpt_counter, 1);
+    EXPECT_FALSE(time.write_last_checkpoint());
+}
+
 } // namespace amr_wind_tests
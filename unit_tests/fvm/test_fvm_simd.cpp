@@ -0,0 +1,276 @@
+#include "aw_test_utils/MeshTest.H"
+#include "aw_test_utils/iter_tools.H"
+#include "amr-wind/fvm/gradient.H"
+#include "amr-wind/fvm/laplacian.H"
+#include "amr-wind/fvm/strainrate.H"
+#include "amr-wind/utilities/trig_ops.H"
+
+#include <type_traits>
+
+namespace amr_wind_tests {
+
+namespace {
+
+// The operators are compared up to round-off because the compiler may contract
+// or reorder the operations of the kernels differently
+
+/** Reference gradient operator
+ *
+ *  Copy of the gradient operator with runtime stencil coefficients, a
+ *  component loop inside the cell loop, and the interior stencil applied on
+ *  the whole tile box.
+ */
+template <typename FTypeIn, typename FTypeOut>
+struct RefGradient
+{
+    RefGradient(FTypeOut& gradphi, const FTypeIn& phi)
+        : m_gradphi(gradphi), m_phi(phi)
+    {}
+
+    template <typename Stencil>
+    void apply(const int lev, const amrex::MFIter& mfi) const
+    {
+        const int ncomp = m_phi.num_comp();
+        const auto& geom = m_phi.repo().mesh().Geom(lev);
+        const auto& idx = geom.InvCellSizeArray();
+        const auto& gradphi_arr = m_gradphi(lev).array(mfi);
+        const auto& phi_arr = m_phi(lev).const_array(mfi);
+
+        const auto& bx_in = mfi.tilebox();
+        const auto& bx = std::is_same_v<
+                             Stencil, amr_wind::fvm::stencil::StencilInterior>
+                             ? bx_in
+                             : Stencil::box(bx_in, geom);
+        if (bx.isEmpty()) {
+            return;
+        }
+
+        amrex::ParallelFor(
+            bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                for (int icomp = 0; icomp < ncomp; icomp++) {
+                    amrex::Real cp1 = Stencil::c00;
+                    amrex::Real c = Stencil::c01;
+                    amrex::Real cm1 = Stencil::c02;
+                    gradphi_arr(i, j, k, icomp * AMREX_SPACEDIM + 0) =
+                        (cp1 * phi_arr(i + 1, j, k, icomp) +
+                         c * phi_arr(i, j, k, icomp) +
+                         cm1 * phi_arr(i - 1, j, k, icomp)) *
+                        idx[0];
+
+                    cp1 = Stencil::c10;
+                    c = Stencil::c11;
+                    cm1 = Stencil::c12;
+                    gradphi_arr(i, j, k, icomp * AMREX_SPACEDIM + 1) =
+                        (cp1 * phi_arr(i, j + 1, k, icomp) +
+                         c * phi_arr(i, j, k, icomp) +
+                         cm1 * phi_arr(i, j - 1, k, icomp)) *
+                        idx[1];
+
+                    cp1 = Stencil::c20;
+                    c = Stencil::c21;
+                    cm1 = Stencil::c22;
+                    gradphi_arr(i, j, k, icomp * AMREX_SPACEDIM + 2) =
+                        (cp1 * phi_arr(i, j, k + 1, icomp) +
+                         c * phi_arr(i, j, k, icomp) +
+                         cm1 * phi_arr(i, j, k - 1, icomp)) *
+                        idx[2];
+                }
+            });
+    }
+
+    FTypeOut& m_gradphi;
+    const FTypeIn& m_phi;
+};
+
+/** Reference laplacian operator with runtime stencil coefficients
+ */
+template <typename FTypeIn, typename FTypeOut>
+struct RefLaplacian
+{
+    RefLaplacian(FTypeOut& lphi, const FTypeIn& phi)
+        : m_lapphi(lphi), m_phi(phi)
+    {}
+
+    template <typename Stencil>
+    void apply(const int lev, const amrex::MFIter& mfi) const
+    {
+        const auto& geom = m_phi.repo().mesh().Geom(lev);
+        const auto& idx = geom.InvCellSizeArray();
+        const auto& lapphi = m_lapphi(lev).array(mfi);
+        const auto& phi = m_phi(lev).const_array(mfi);
+
+        const auto& bx = Stencil::box(mfi.tilebox(), geom);
+        if (bx.isEmpty()) {
+            return;
+        }
+
+        amrex::ParallelFor(
+            bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                amrex::Real sp1 = Stencil::s00;
+                amrex::Real s = Stencil::s01;
+                amrex::Real sm1 = Stencil::s02;
+                const amrex::Real d2phidx2 =
+                    (sp1 * phi(i + 1, j, k, 0) + s * phi(i, j, k, 0) +
+                     sm1 * phi(i - 1, j, k, 0)) *
+                    idx[0] * idx[0];
+                sp1 = Stencil::s10;
+                s = Stencil::s11;
+                sm1 = Stencil::s12;
+                const amrex::Real d2phidy2 =
+                    (sp1 * phi(i, j + 1, k, 1) + s * phi(i, j, k, 1) +
+                     sm1 * phi(i, j - 1, k, 1)) *
+                    idx[1] * idx[1];
+                sp1 = Stencil::s20;
+                s = Stencil::s21;
+                sm1 = Stencil::s22;
+                const amrex::Real d2phidz2 =
+                    (sp1 * phi(i, j, k + 1, 2) + s * phi(i, j, k, 2) +
+                     sm1 * phi(i, j, k - 1, 2)) *
+                    idx[2] * idx[2];
+                lapphi(i, j, k) = d2phidx2 + d2phidy2 + d2phidz2;
+            });
+    }
+
+    FTypeOut& m_lapphi;
+    const FTypeIn& m_phi;
+};
+
+void init_field(amr_wind::Field& fld)
+{
+    const auto& geom = fld.repo().mesh().Geom();
+    run_algorithm(fld, [&](const int lev, const amrex::MFIter& mfi) {
+        const auto& dx = geom[lev].CellSizeArray();
+        const auto& farr = fld(lev).array(mfi);
+        amrex::ParallelFor(
+            mfi.growntilebox(), fld.num_comp(),
+            [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
+                constexpr amrex::Real twopi = amr_wind::utils::two_pi();
+                const amrex::Real x = (i + 0.5) * dx[0];
+                const amrex::Real y = (j + 0.5) * dx[1];
+                const amrex::Real z = (k + 0.5) * dx[2];
+                farr(i, j, k, n) = std::sin(twopi * (x + 0.5 * n)) *
+                                   std::cos(twopi * y) * (1.0 + z * z);
+            });
+    });
+}
+
+amrex::Real max_norm(const amr_wind::Field& fld)
+{
+    amrex::Real norm = 0.0;
+    const int nlevels = fld.repo().num_active_levels();
+    for (int lev = 0; lev < nlevels; ++lev) {
+        norm = amrex::max(norm, fld(lev).norm0(0, fld.num_comp(), 0));
+    }
+    return norm;
+}
+
+amrex::Real max_diff(amr_wind::Field& fld, const amr_wind::Field& ref)
+{
+    amrex::Real diff = 0.0;
+    const int nlevels = fld.repo().num_active_levels();
+    for (int lev = 0; lev < nlevels; ++lev) {
+        amrex::MultiFab::Subtract(fld(lev), ref(lev), 0, 0, fld.num_comp(), 0);
+        diff = amrex::max(diff, fld(lev).norm0(0, fld.num_comp(), 0));
+    }
+    return diff;
+}
+
+} // namespace
+
+class FvmSimdTest : public MeshTest
+{
+protected:
+    void populate_parameters() override
+    {
+        MeshTest::populate_parameters();
+        {
+            amrex::ParmParse pp("amr");
+            amrex::Vector<int> ncell{{nx, nx, nx}};
+            pp.add("max_level", 0);
+            pp.add("max_grid_size", nx / 2);
+            pp.addarr("n_cell", ncell);
+        }
+        {
+            // Exercise both the periodic and the one-sided boundary stencils
+            amrex::ParmParse pp("geometry");
+            amrex::Vector<int> periodic{{0, 1, 0}};
+            pp.addarr("is_periodic", periodic);
+        }
+    }
+
+    const int nx = 32;
+};
+
+TEST_F(FvmSimdTest, gradient)
+{
+    initialize_mesh();
+    auto& repo = sim().repo();
+    auto& phi = repo.declare_field("phi", 2, 1);
+    auto& grad = repo.declare_field("grad", 2 * AMREX_SPACEDIM, 0);
+    auto& grad_ref = repo.declare_field("grad_ref", 2 * AMREX_SPACEDIM, 0);
+    init_field(phi);
+
+    RefGradient<amr_wind::Field, amr_wind::Field> ref_op(grad_ref, phi);
+    amr_wind::fvm::impl::apply(ref_op, phi);
+    amr_wind::fvm::gradient(grad, phi);
+
+    const amrex::Real tol = 1.0e-12 * max_norm(grad_ref);
+    EXPECT_NEAR(max_diff(grad, grad_ref), 0.0, tol);
+}
+
+TEST_F(FvmSimdTest, laplacian)
+{
+    initialize_mesh();
+    auto& repo = sim().repo();
+    auto& phi = repo.declare_field("phi", AMREX_SPACEDIM, 1);
+    auto& lap = repo.declare_field("lap", 1, 0);
+    auto& lap_ref = repo.declare_field("lap_ref", 1, 0);
+    init_field(phi);
+
+    RefLaplacian<amr_wind::Field, amr_wind::Field> ref_op(lap_ref, phi);
+    amr_wind::fvm::impl::apply(ref_op, phi);
+    amr_wind::fvm::laplacian(lap, phi);
+
+    const amrex::Real tol = 1.0e-12 * max_norm(lap_ref);
+    EXPECT_NEAR(max_diff(lap, lap_ref), 0.0, tol);
+}
+
+TEST_F(FvmSimdTest, strainrate)
+{
+    initialize_mesh();
+    auto& repo = sim().repo();
+    auto& vel = repo.declare_field("vel", AMREX_SPACEDIM, 1);
+    auto& grad = repo.declare_field("grad", AMREX_SPACEDIM * AMREX_SPACEDIM, 0);
+    auto& str = repo.declare_field("str", 1, 0);
+    auto& str_ref = repo.declare_field("str_ref", 1, 0);
+    init_field(vel);
+
+    // Strain rate magnitude computed from the velocity gradient tensor
+    amr_wind::fvm::gradient(grad, vel);
+    run_algorithm(str_ref, [&](const int lev, const amrex::MFIter& mfi) {
+        const auto& g = grad(lev).const_array(mfi);
+        const auto& s = str_ref(lev).array(mfi);
+        amrex::ParallelFor(
+            mfi.tilebox(), [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                const amrex::Real ux = g(i, j, k, 0);
+                const amrex::Real uy = g(i, j, k, 1);
+                const amrex::Real uz = g(i, j, k, 2);
+                const amrex::Real vx = g(i, j, k, 3);
+                const amrex::Real vy = g(i, j, k, 4);
+                const amrex::Real vz = g(i, j, k, 5);
+                const amrex::Real wx = g(i, j, k, 6);
+                const amrex::Real wy = g(i, j, k, 7);
+                const amrex::Real wz = g(i, j, k, 8);
+                s(i, j, k) = std::sqrt(
+                    2.0 * std::pow(ux, 2) + 2.0 * std::pow(vy, 2) +
+                    2.0 * std::pow(wz, 2) + std::pow(uy + vx, 2) +
+                    std::pow(vz + wy, 2) + std::pow(wx + uz, 2));
+            });
+    });
+
+    amr_wind::fvm::strainrate(str, vel);
+    const amrex::Real tol = 1.0e-12 * max_norm(str_ref);
+    EXPECT_NEAR(max_diff(str, str_ref), 0.0, tol);
+}
+
+} // namespace amr_wind_tests
@@ -0,0 +1,214 @@
+#include <sstream>
+
+#include "aw_test_utils/MeshTest.H"
+#include "amr-wind/immersed_boundary/IB.H"
+#include "amr-wind/utilities/tagging/CartBoxRefinement.H"
+
+namespace amr_wind_tests {
+
+namespace {
+
+constexpr int solid_flag = 1;
+constexpr int forcing_flag = 2;
+constexpr int interior_flag = 4;
+
+//! Mesh that can be regridded after the refinement criteria change
+class IBRefineMesh : public RefineMesh
+{
+public:
+    void remesh() { regrid(0, 0.0); }
+};
+
+//! Signed distance to a sphere of radius 3 centered at (8, 8, 8)
+void init_levelset(amr_wind::Field& levelset)
+{
+    const int nlevels = levelset.repo().num_active_levels();
+    for (int lev = 0; lev < nlevels; ++lev) {
+        const auto& geom = levelset.repo().mesh().Geom(lev);
+        const auto& problo = geom.ProbLoArray();
+        const auto& dx = geom.CellSizeArray();
+        for (amrex::MFIter mfi(levelset(lev)); mfi.isValid(); ++mfi) {
+            const auto& phi = levelset(lev).array(mfi);
+            amrex::ParallelFor(
+                mfi.growntilebox(),
+                [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                    const amrex::Real x = problo[0] + (i + 0.5) * dx[0] - 8.0;
+                    const amrex::Real y = problo[1] + (j + 0.5) * dx[1] - 8.0;
+                    const amrex::Real z = problo[2] + (k + 0.5) * dx[2] - 8.0;
+                    phi(i, j, k) = std::sqrt(x * x + y * y + z * z) - 3.0;
+                });
+        }
+    }
+}
+
+void mark_cells(
+    const amr_wind::ib::IBCellList::CellList& cells,
+    const amrex::Array4<int>& marr,
+    const int flag)
+{
+    const auto* iv_arr = cells.data();
+    amrex::ParallelFor(
+        static_cast<int>(cells.size()), [=] AMREX_GPU_DEVICE(int n) noexcept {
+            amrex::Gpu::Atomic::AddNoRet(&marr(iv_arr[n]), flag);
+        });
+}
+
+//! Number of cells where the cached lists differ from a levelset sweep
+int num_mismatches(
+    const amr_wind::ib::IBCellList& cells,
+    const amr_wind::Field& levelset,
+    const int lev)
+{
+    const auto& dx = levelset.repo().mesh().Geom(lev).CellSizeArray();
+    const amrex::Real phi_b = std::cbrt(dx[0] * dx[1] * dx[2]);
+
+    const auto& lfab = levelset(lev);
+    amrex::iMultiFab expected(
+        lfab.boxArray(), lfab.DistributionMap(), 1, lfab.nGrow());
+    amrex::iMultiFab actual(
+        lfab.boxArray(), lfab.DistributionMap(), 1, lfab.nGrow());
+    actual.setVal(0);
+
+    for (amrex::MFIter mfi(lfab); mfi.isValid(); ++mfi) {
+        const auto& bx = mfi.validbox();
+        const auto phi = lfab.const_array(mfi);
+        const auto earr = expected.array(mfi);
+        amrex::ParallelFor(
+            mfi.fabbox(), [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                int flag = (phi(i, j, k) <= 0.0) ? interior_flag : 0;
+                if (bx.contains(amrex::IntVect(i, j, k))) {
+                    if (phi(i, j, k) < -phi_b) {
+                        flag += solid_flag;
+                    } else if (phi(i, j, k) < 0.0) {
+                        flag += forcing_flag;
+                    }
+                }
+                earr(i, j, k) = flag;
+            });
+
+        const auto aarr = actual.array(mfi);
+        mark_cells(cells.solid_cells(lev, mfi), aarr, solid_flag);
+        mark_cells(cells.forcing_cells(lev, mfi), aarr, forcing_flag);
+        mark_cells(cells.interior_cells(lev, mfi), aarr, interior_flag);
+    }
+
+    int nmismatch = amrex::ReduceSum(
+        expected, actual, expected.nGrow(),
+        [=] AMREX_GPU_HOST_DEVICE(
+            amrex::Box const& b, amrex::Array4<int const> const& earr,
+            amrex::Array4<int const> const& aarr) -> int {
+            int nm = 0;
+            amrex::Loop(b, [=, &nm](int i, int j, int k) noexcept {
+                nm += (earr(i, j, k) != aarr(i, j, k)) ? 1 : 0;
+            });
+            return nm;
+        });
+    amrex::ParallelDescriptor::ReduceIntSum(nmismatch);
+    return nmismatch;
+}
+
+} // namespace
+
+class IBCellListTest : public MeshTest
+{
+protected:
+    void populate_parameters() override
+    {
+        MeshTest::populate_parameters();
+
+        {
+            amrex::ParmParse pp("amr");
+            amrex::Vector<int> ncell{{nx, nx, nx}};
+            pp.add("max_level", 1);
+            pp.add("max_grid_size", nx / 2);
+            pp.add("blocking_factor", 4);
+            pp.addarr("n_cell", ncell);
+        }
+        {
+            amrex::ParmParse pp("geometry");
+            amrex::Vector<amrex::Real> problo{{0.0, 0.0, 0.0}};
+            amrex::Vector<amrex::Real> probhi{{16.0, 16.0, 16.0}};
+            pp.addarr("prob_lo", problo);
+            pp.addarr("prob_hi", probhi);
+        }
+    }
+
+    void refine_box(const std::string& bounds)
+    {
+        std::stringstream ss;
+        ss << "1 // Number of levels" << std::endl;
+        ss << "1 // Number of boxes at this level" << std::endl;
+        ss << bounds << std::endl;
+
+        auto& crit = mesh<IBRefineMesh>()->refine_criteria_vec();
+        crit.clear();
+        std::unique_ptr<amr_wind::CartBoxRefinement> box_refine(
+            new amr_wind::CartBoxRefinement(sim()));
+        box_refine->read_inputs(mesh(), ss);
+        crit.push_back(std::move(box_refine));
+    }
+
+    void create_refined_mesh()
+    {
+        populate_parameters();
+        create_mesh_instance<IBRefineMesh>();
+        refine_box("2.0 2.0 2.0 8.0 14.0 14.0");
+        initialize_mesh();
+    }
+
+    const int nx = 16;
+};
+
+TEST_F(IBCellListTest, matches_levelset)
+{
+    create_refined_mesh();
+    ASSERT_EQ(mesh().finestLevel(), 1);
+
+    amr_wind::ib::IB ib(sim());
+    auto& levelset = sim().repo().get_field("ib_levelset");
+    init_levelset(levelset);
+
+    auto& cells = ib.cell_list();
+    EXPECT_FALSE(cells.valid());
+    cells.build();
+    EXPECT_TRUE(cells.valid());
+    EXPECT_GT(cells.num_solid_cells(), 0);
+    EXPECT_GT(cells.num_forcing_cells(), 0);
+
+    for (int lev = 0; lev <= mesh().finestLevel(); ++lev) {
+        EXPECT_EQ(num_mismatches(cells, levelset, lev), 0);
+    }
+}
+
+TEST_F(IBCellListTest, rebuild_after_regrid)
+{
+    create_refined_mesh();
+    ASSERT_EQ(mesh().finestLevel(), 1);
+
+    amr_wind::ib::IB ib(sim());
+    auto& levelset = sim().repo().get_field("ib_levelset");
+    init_levelset(levelset);
+
+    auto& cells = ib.cell_list();
+    cells.build();
+    const amrex::BoxArray old_ba = mesh().boxArray(1);
+
+    // Move the refined region to the other half of the sphere
+    refine_box("8.0 2.0 2.0 14.0 14.0 14.0");
+    mesh<IBRefineMesh>()->remesh();
+    ASSERT_EQ(mesh().finestLevel(), 1);
+    EXPECT_FALSE(mesh().boxArray(1) == old_ba);
+
+    // The regrid hook invalidates the lists
+    ib.post_regrid_actions();
+    EXPECT_FALSE(cells.valid());
+
+    init_levelset(levelset);
+    cells.build();
+    EXPECT_TRUE(cells.valid());
+    for (int lev = 0; lev <= mesh().finestLevel(); ++lev) {
+        EXPECT_EQ(num_mismatches(cells, levelset, lev), 0);
+    }
+}
+
+} // namespace amr_wind_tests
@@ -162,7 +162,8 @@ protected:
         }
     }
 
-    void testing_coorddir(const int dir, amrex::Real CFL)
+    void
+    testing_coorddir(const int dir, amrex::Real CFL, const bool banded = false)
     {
         constexpr double tol = 1.0e-15;
 
@@ -182,6 +183,10 @@ protected:
             amrex::Vector<int> periodic{{1, 1, 1}};
             pp.addarr("is_periodic", periodic);
         }
+        {
+            amrex::ParmParse pp("VOF");
+            pp.add("banded_advection", (int)banded);
+        }
         // dir = -2 corresponds to multi-level
         if (dir == -2) {
             {
@@ -261,6 +266,63 @@ protected:
             check_accuracy(dir, m_nx, tol, vof);
         }
     }
+
+    //! Advect the diagonal interface on a mesh split into several boxes, so
+    //! that most tiles only contain pure-phase cells, and return the result
+    amrex::MultiFab advect_multibox(const bool banded)
+    {
+        constexpr int nx = 8;
+        const amrex::Real ft_time = 1.0 / m_vel;
+        const int niter = (int)round(nx / 0.45);
+        dt = ft_time / ((amrex::Real)niter);
+
+        m_mesh.reset();
+        populate_parameters();
+        {
+            amrex::ParmParse pp("amr");
+            amrex::Vector<int> ncell{{nx, nx, nx}};
+            pp.add("max_grid_size", nx / 2);
+            pp.add("blocking_factor", 2);
+            pp.addarr("n_cell", ncell);
+        }
+        {
+            amrex::ParmParse pp("geometry");
+            amrex::Vector<int> periodic{{1, 1, 1}};
+            pp.addarr("is_periodic", periodic);
+        }
+        {
+            amrex::ParmParse pp("VOF");
+            pp.add("banded_advection", (int)banded);
+        }
+        initialize_mesh();
+
+        auto& repo = sim().repo();
+        auto& pde_mgr = sim().pde_manager();
+        pde_mgr.register_icns();
+        sim().init_physics();
+
+        auto& vof = repo.get_field("vof");
+        initialize_volume_fractions(-1, nx, vof);
+        amrex::GpuArray<amrex::Real, 3> varr = {m_vel, m_vel, m_vel};
+        initialize_adv_velocities(
+            vof, repo.get_field("u_mac"), repo.get_field("v_mac"),
+            repo.get_field("w_mac"), varr);
+
+        auto& seqn = pde_mgr(
+            amr_wind::pde::VOF::pde_name() + "-" +
+            amr_wind::fvm::Godunov::scheme_name());
+        seqn.initialize();
+        for (int n = 0; n < niter; ++n) {
+            seqn.compute_advection_term(amr_wind::FieldState::Old);
+            seqn.post_solve_actions();
+        }
+
+        amrex::MultiFab result(
+            vof(0).boxArray(), vof(0).DistributionMap(), 1, 0);
+        amrex::MultiFab::Copy(result, vof(0), 0, 0, 1, 0);
+        return result;
+    }
+
     const amrex::Real m_rho1 = 1000.0;
     const amrex::Real m_rho2 = 1.0;
     const amrex::Real m_vel = 5.0;
@@ -277,5 +339,22 @@ TEST_F(VOFConsTest, CFL045) { testing_coorddir(-1, 0.45); }
 TEST_F(VOFConsTest, CFL01) { testing_coorddir(-1, 0.1); }
 // Test transport across multiple mesh levels - just check conservation
 TEST_F(VOFConsTest, 2level) { testing_coorddir(-2, 0.5 * 0.45); }
+// Pure-phase tiles use the algebraic fluxes when banded advection is enabled
+TEST_F(VOFConsTest, banded_X) { testing_coorddir(0, 0.45, true); }
+TEST_F(VOFConsTest, banded_CFL045) { testing_coorddir(-1, 0.45, true); }
+TEST_F(VOFConsTest, banded_2level) { testing_coorddir(-2, 0.5 * 0.45, true); }
+
+// Skipping the reconstruction in pure-phase tiles does not change the result
+TEST_F(VOFConsTest, banded_matches_unbanded)
+{
+    const auto ref = advect_multibox(false);
+    const auto banded = advect_multibox(true);
+    ASSERT_GT(ref.boxArray().size(), 1);
+
+    amrex::MultiFab diff(ref.boxArray(), ref.DistributionMap(), 1, 0);
+    diff.ParallelCopy(banded);
+    amrex::MultiFab::Subtract(diff, ref, 0, 0, 1, 0);
+    EXPECT_EQ(diff.norm0(0), 0.0);
+}
 
 } // namespace amr_wind_tests
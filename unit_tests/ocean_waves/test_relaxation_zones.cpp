@@ -2,6 +2,7 @@
 #include "aw_test_utils/iter_tools.H"
 #include "aw_test_utils/test_utils.H"
 #include "amr-wind/ocean_waves/utils/wave_utils_K.H"
+#include "amr-wind/ocean_waves/relaxation_zones/stokes_waves_K.H"
 #include "amr-wind/ocean_waves/OceanWaves.H"
 #include "amr-wind/physics/multiphase/MultiPhase.H"
 
@@ -264,6 +265,104 @@ void interp_reference_fields(
     });
 }
 
+//! Direct per-cell evaluation of the wave solutions, used as reference
+void init_wave_reference_fields(
+    amr_wind::Field& ref_lvs,
+    amr_wind::Field& ref_vel,
+    const int order,
+    const amrex::Real wavelength,
+    const amrex::Real waterdepth,
+    const amrex::Real waveheight,
+    const amrex::Real time)
+{
+    const auto& geom = ref_lvs.repo().mesh().Geom();
+    run_algorithm(ref_lvs, [&](const int lev, const amrex::MFIter& mfi) {
+        auto lvs_arr = ref_lvs(lev).array(mfi);
+        auto vel_arr = ref_vel(lev).array(mfi);
+        const auto& bx = mfi.validbox();
+        const auto& dx = geom[lev].CellSizeArray();
+        const auto& problo = geom[lev].ProbLoArray();
+        amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+            const amrex::Real x = problo[0] + (i + 0.5) * dx[0];
+            const amrex::Real z = problo[2] + (k + 0.5) * dx[2];
+
+            amrex::Real eta{0.0}, u_w{0.0}, v_w{0.0}, w_w{0.0};
+            if (order > 0) {
+                amr_wind::ocean_waves::relaxation_zones::stokes_waves(
+                    order, wavelength, waterdepth, waveheight, x, time, eta,
+                    u_w, v_w, w_w);
+            } else {
+                const amrex::Real wavenumber = 2. * M_PI / wavelength;
+                const amrex::Real omega = std::pow(
+                    wavenumber * 9.81 * std::tanh(wavenumber * waterdepth),
+                    0.5);
+                const amrex::Real phase = wavenumber * x - omega * time;
+                eta = waveheight / 2.0 * std::cos(phase);
+                u_w = omega * waveheight / 2.0 *
+                      std::cosh(wavenumber * (z + waterdepth)) /
+                      std::sinh(wavenumber * waterdepth) * std::cos(phase);
+                w_w = omega * waveheight / 2.0 *
+                      std::sinh(wavenumber * (z + waterdepth)) /
+                      std::sinh(wavenumber * waterdepth) * std::sin(phase);
+            }
+
+            lvs_arr(i, j, k) = eta - z;
+            const bool wet = (lvs_arr(i, j, k) + 0.5 * dx[2] >= 0);
+            vel_arr(i, j, k, 0) = wet ? u_w : 0.0;
+            vel_arr(i, j, k, 1) = wet ? v_w : 0.0;
+            vel_arr(i, j, k, 2) = wet ? w_w : 0.0;
+        });
+    });
+}
+
+void check_wave_kinematics(
+    amr_wind::CFDSim& sim,
+    const std::string& wave_type,
+    const int order,
+    const amrex::Real tol)
+{
+    const amrex::Real wavelength = 2.5;
+    const amrex::Real waterdepth = 0.5;
+    const amrex::Real waveheight = 0.1;
+    {
+        amrex::ParmParse pp("OceanWaves");
+        pp.add("label", (std::string) "wave_ow");
+        amrex::ParmParse ppow("OceanWaves.wave_ow");
+        ppow.add("type", wave_type);
+        ppow.add("wave_length", wavelength);
+        ppow.add("wave_height", waveheight);
+        ppow.add("water_depth", waterdepth);
+        if (order > 0) {
+            ppow.add("order", order);
+        }
+    }
+
+    auto& pde_mgr = sim.pde_manager();
+    pde_mgr.register_icns();
+    sim.init_physics();
+    auto& oceanwaves =
+        sim.physics_manager().get<amr_wind::ocean_waves::OceanWaves>();
+    oceanwaves.pre_init_actions();
+
+    auto& repo = sim.repo();
+    auto& ow_levelset = repo.get_field("ow_levelset");
+    auto& ow_velocity = repo.get_field("ow_velocity");
+    ow_levelset.setVal(0.0);
+    ow_velocity.setVal(0.0);
+    auto& ref_levelset = repo.declare_field("ref_levelset", 1, 3);
+    auto& ref_velocity = repo.declare_field("ref_velocity", 3, 3);
+
+    // Advance time so that the wave phase is non-trivial
+    sim.time().new_timestep();
+    oceanwaves.post_init_actions();
+
+    init_wave_reference_fields(
+        ref_levelset, ref_velocity, order, wavelength, waterdepth, waveheight,
+        sim.time().new_time());
+    EXPECT_NEAR(field_error(ref_levelset, ow_levelset), 0.0, tol);
+    EXPECT_NEAR(field_error(ref_velocity, ow_velocity, 3), 0.0, tol);
+}
+
 } // namespace
 
 TEST_F(OceanWavesOpTest, relaxation_zone)
@@ -533,4 +632,26 @@ TEST_F(OceanWavesOpTest, HOS_restart)
     }
 }
 
+TEST_F(OceanWavesOpTest, linear_waves_tabulated)
+{
+    populate_parameters();
+    {
+        amrex::ParmParse pp("time");
+        pp.add("fixed_dt", 0.3);
+    }
+    initialize_mesh();
+    check_wave_kinematics(sim(), "LinearWaves", 0, 1.0e-12);
+}
+
+TEST_F(OceanWavesOpTest, stokes_waves_tabulated)
+{
+    populate_parameters();
+    {
+        amrex::ParmParse pp("time");
+        pp.add("fixed_dt", 0.3);
+    }
+    initialize_mesh();
+    check_wave_kinematics(sim(), "StokesWaves", 5, 1.0e-12);
+}
+
 } // namespace amr_wind_tests
@@ -0,0 +1,131 @@
+#include "aw_test_utils/MeshTest.H"
+
+#include "amr-wind/utilities/BuddyCheckpoint.H"
+
+namespace amr_wind_tests {
+
+namespace {
+
+void init_field(amr_wind::Field& fld, const amrex::Real offset)
+{
+    const int nlevels = fld.repo().num_active_levels();
+    const int ncomp = fld.num_comp();
+
+    for (int lev = 0; lev < nlevels; ++lev) {
+        for (amrex::MFIter mfi(fld(lev)); mfi.isValid(); ++mfi) {
+            auto bx = mfi.validbox();
+            const auto& farr = fld(lev).array(mfi);
+
+            amrex::ParallelFor(
+                bx, ncomp, [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) {
+                    farr(i, j, k, n) = offset + i + 2.0 * j - k + 10.0 * n;
+                });
+        }
+    }
+}
+
+amrex::Real max_error(amr_wind::Field& fld, const amrex::Real offset)
+{
+    const int nlevels = fld.repo().num_active_levels();
+    const int ncomp = fld.num_comp();
+    amrex::Real error = 0.0;
+
+    for (int lev = 0; lev < nlevels; ++lev) {
+        error = amrex::max(
+            error, amrex::ReduceMax(
+                       fld(lev), 0,
+                       [=] AMREX_GPU_HOST_DEVICE(
+                           amrex::Box const& bx,
+                           amrex::Array4<amrex::Real const> const& farr)
+                           -> amrex::Real {
+                           amrex::Real err = 0.0;
+                           amrex::Loop(
+                               bx, ncomp,
+                               [=, &err](int i, int j, int k, int n) noexcept {
+                                   const amrex::Real ref =
+                                       offset + i + 2.0 * j - k + 10.0 * n;
+                                   err = amrex::max(
+                                       err, amrex::Math::abs(
+                                                farr(i, j, k, n) - ref));
+                               });
+                           return err;
+                       }));
+    }
+    amrex::ParallelDescriptor::ReduceRealMax(error);
+    return error;
+}
+
+} // namespace
+
+class BuddyCheckpointTest : public MeshTest
+{
+protected:
+    void populate_parameters() override
+    {
+        MeshTest::populate_parameters();
+        {
+            amrex::ParmParse pp("amr");
+            amrex::Vector<int> ncell{{nx, nx, nx}};
+            pp.add("max_level", 0);
+            pp.add("max_grid_size", nx / 2);
+            pp.addarr("n_cell", ncell);
+        }
+        {
+            amrex::ParmParse pp("io");
+            pp.add("buddy_checkpoint_interval", 2);
+            amrex::Vector<int> fail_inp{{5, 1}};
+            pp.addarr("buddy_checkpoint_test_failure", fail_inp);
+        }
+    }
+
+    const int nx = 16;
+};
+
+TEST_F(BuddyCheckpointTest, save_restore)
+{
+    initialize_mesh();
+    auto& vel = sim().repo().declare_field("vel", 3, 1);
+    auto& pres = sim().repo().declare_nd_field("pres", 1, 0);
+    auto& time = sim().time();
+
+    amr_wind::BuddyCheckpoint buddy(sim(), {&vel, &pres});
+    buddy.initialize();
+    EXPECT_TRUE(buddy.enabled());
+    EXPECT_FALSE(buddy.has_snapshot());
+
+    time.set_restart_time(4, 0.4);
+    time.deltaT() = 0.1;
+    EXPECT_TRUE(buddy.is_snapshot_step());
+    init_field(vel, 0.0);
+    init_field(pres, 1.0);
+    buddy.save();
+    EXPECT_EQ(buddy.snapshot_time_index(), 4);
+    EXPECT_GT(buddy.memory_footprint(), 0);
+
+    // Advance the solution and roll back
+    init_field(vel, 5.0);
+    init_field(pres, 5.0);
+    time.set_restart_time(5, 0.5);
+    time.deltaT() = 0.2;
+    buddy.restore();
+    EXPECT_EQ(time.time_index(), 4);
+    EXPECT_NEAR(time.new_time(), 0.4, 1.0e-12);
+    EXPECT_NEAR(time.deltaT(), 0.1, 1.0e-12);
+    EXPECT_NEAR(max_error(vel, 0.0), 0.0, 1.0e-12);
+    EXPECT_NEAR(max_error(pres, 1.0), 0.0, 1.0e-12);
+
+    // Simulated loss of a rank recovers its data from the buddy
+    init_field(vel, 5.0);
+    init_field(pres, 5.0);
+    time.set_restart_time(5, 0.5);
+    EXPECT_TRUE(buddy.test_failure());
+    EXPECT_EQ(time.time_index(), 4);
+    EXPECT_NEAR(max_error(vel, 0.0), 0.0, 1.0e-12);
+    EXPECT_NEAR(max_error(pres, 1.0), 0.0, 1.0e-12);
+
+    // The failure is only simulated once
+    time.set_restart_time(5, 0.5);
+    EXPECT_FALSE(buddy.test_failure());
+}
+
+} // namespace amr_wind_tests
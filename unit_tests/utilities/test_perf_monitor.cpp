@@ -0,0 +1,122 @@
+#include "aw_test_utils/MeshTest.H"
+
+#include "amr-wind/utilities/PerfMonitor.H"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+namespace amr_wind_tests {
+
+namespace {
+
+int column_index(
+    const amrex::Vector<std::string>& names, const std::string& name)
+{
+    return static_cast<int>(
+        std::find(names.begin(), names.end(), name) - names.begin());
+}
+
+amrex::Vector<std::string> split_csv(const std::string& line)
+{
+    amrex::Vector<std::string> tokens;
+    std::istringstream iss(line);
+    std::string tok;
+    while (std::getline(iss, tok, ',')) {
+        tokens.push_back(tok);
+    }
+    return tokens;
+}
+
+} // namespace
+
+class PerfMonitorTest : public MeshTest
+{
+protected:
+    void populate_parameters() override
+    {
+        MeshTest::populate_parameters();
+        {
+            amrex::ParmParse pp("io");
+            pp.add("perf_monitor", true);
+            pp.add("perf_monitor_flush_interval", 2);
+            pp.add("perf_monitor_file", m_fname);
+        }
+    }
+
+    const std::string m_fname{"perf_monitor_test.csv"};
+};
+
+TEST_F(PerfMonitorTest, csv_time_series)
+{
+    using Phase = amr_wind::PerfMonitor::Phase;
+    using Counter = amr_wind::PerfMonitor::Counter;
+
+    initialize_mesh();
+    auto& fld = sim().repo().declare_field("scalar", 1, 1);
+    fld.set_default_fillpatch_bc(sim().time());
+    fld.setVal(1.0);
+    auto& perf = sim().perf_monitor();
+    perf.initialize();
+    EXPECT_TRUE(perf.enabled());
+
+    constexpr int num_steps = 3;
+    for (int it = 0; it < num_steps; ++it) {
+        perf.begin_step();
+        {
+            amr_wind::PerfMonitor::ScopedPhase phase(perf, Phase::PreAdvance);
+            fld.fillpatch(0.0);
+        }
+        {
+            amr_wind::PerfMonitor::ScopedPhase phase(perf, Phase::Advance);
+            perf.add(Counter::Particles, it + 1);
+        }
+        perf.end_step();
+    }
+
+    // Samples are buffered until the flush interval is reached
+    EXPECT_EQ(perf.num_buffered(), 1);
+    perf.flush();
+    EXPECT_EQ(perf.num_buffered(), 0);
+
+    if (!amrex::ParallelDescriptor::IOProcessor()) {
+        return;
+    }
+
+    const auto names = amr_wind::PerfMonitor::column_names();
+    const int ipart = column_index(names, "particles");
+    const int iadv_part = column_index(names, "advance_particles");
+    const int ipre_part = column_index(names, "pre_advance_particles");
+    const int ihalo = column_index(names, "halo_exchanges");
+    const int ipre_halo = column_index(names, "pre_advance_halo_exchanges");
+    const int iadv_halo = column_index(names, "advance_halo_exchanges");
+    const int iadv = column_index(names, "advance");
+    const int itotal = column_index(names, "step_total");
+    const int nprocs = amrex::ParallelDescriptor::NProcs();
+    const int nlevels = sim().repo().num_active_levels();
+
+    std::ifstream fh(m_fname);
+    std::string line;
+    std::getline(fh, line);
+    EXPECT_EQ(split_csv(line), names);
+
+    int nrows = 0;
+    while (std::getline(fh, line)) {
+        const auto tokens = split_csv(line);
+        ASSERT_EQ(tokens.size(), names.size());
+        ++nrows;
+        // Counters are summed over all ranks
+        EXPECT_EQ(std::stol(tokens[ipart]), nrows * nprocs);
+        // Counters are attributed to the phases where they occur
+        EXPECT_EQ(std::stol(tokens[iadv_part]), nrows * nprocs);
+        EXPECT_EQ(std::stol(tokens[ipre_part]), 0);
+        EXPECT_EQ(std::stol(tokens[ihalo]), nlevels);
+        EXPECT_EQ(std::stol(tokens[ipre_halo]), nlevels);
+        EXPECT_EQ(std::stol(tokens[iadv_halo]), 0);
+        EXPECT_GE(std::stod(tokens[iadv]), 0.0);
+        EXPECT_GE(std::stod(tokens[itotal]), std::stod(tokens[iadv]));
+    }
+    EXPECT_EQ(nrows, num_steps);
+}
+
+} // namespace amr_wind_tests
@@ -0,0 +1,100 @@
+#include "aw_test_utils/MeshTest.H"
+
+#include "amr-wind/utilities/IOManager.H"
+
+namespace amr_wind_tests {
+
+class PlotSubsamplingTest : public MeshTest
+{
+protected:
+    void populate_parameters() override
+    {
+        MeshTest::populate_parameters();
+        {
+            amrex::ParmParse pp("amr");
+            amrex::Vector<int> ncell{{nx, nx, nx}};
+            pp.add("max_level", 0);
+            pp.add("max_grid_size", nx / 2);
+            pp.addarr("n_cell", ncell);
+        }
+        {
+            amrex::ParmParse pp("geometry");
+            amrex::Vector<amrex::Real> problo{{0.0, 0.0, 0.0}};
+            amrex::Vector<amrex::Real> probhi{{1.0, 1.0, 1.0}};
+            pp.addarr("prob_lo", problo);
+            pp.addarr("prob_hi", probhi);
+        }
+        {
+            amrex::ParmParse pp("io");
+            pp.addarr("plot_coarsen_ratio", amrex::Vector<int>{2});
+            pp.addarr("plot_regions", amrex::Vector<std::string>{"r1", "r2"});
+        }
+        {
+            // Overlapping regions covering the lower half of the domain in x
+            amrex::ParmParse pp("io.r1");
+            amrex::Vector<amrex::Real> lo{{0.0, 0.0, 0.0}};
+            amrex::Vector<amrex::Real> hi{{0.3, 1.0, 1.0}};
+            pp.addarr("lo", lo);
+            pp.addarr("hi", hi);
+        }
+        {
+            amrex::ParmParse pp("io.r2");
+            amrex::Vector<amrex::Real> lo{{0.2, 0.0, 0.0}};
+            amrex::Vector<amrex::Real> hi{{0.5, 1.0, 1.0}};
+            pp.addarr("lo", lo);
+            pp.addarr("hi", hi);
+        }
+    }
+
+    const int nx = 16;
+};
+
+TEST_F(PlotSubsamplingTest, coarsen_and_clip)
+{
+    initialize_mesh();
+    auto& io_mgr = sim().io_manager();
+    io_mgr.initialize_io();
+    EXPECT_TRUE(io_mgr.subsample_plot_files());
+
+    auto& fld = sim().repo().declare_field("ptest", 1, 0);
+    for (amrex::MFIter mfi(fld(0)); mfi.isValid(); ++mfi) {
+        const auto& farr = fld(0).array(mfi);
+        amrex::ParallelFor(
+            mfi.validbox(), [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+                farr(i, j, k) = i + 2.0 * j + 4.0 * k;
+            });
+    }
+
+    amrex::Vector<amrex::MultiFab> out_mf;
+    amrex::Vector<amrex::Geometry> out_geom;
+    amrex::Vector<amrex::IntVect> out_ratio;
+    const int nout =
+        io_mgr.subsample_plot_data({&fld(0)}, out_mf, out_geom, out_ratio);
+    ASSERT_EQ(nout, 1);
+    EXPECT_EQ(out_geom[0].Domain(), amrex::Box({0, 0, 0}, {7, 7, 7}));
+
+    // Half of the coarsened domain without duplicate cells
+    const auto& ba = out_mf[0].boxArray();
+    EXPECT_EQ(ba.numPts(), (nx / 4) * (nx / 2) * (nx / 2));
+    EXPECT_TRUE(ba.isDisjoint());
+    EXPECT_EQ(ba.minimalBox(), amrex::Box({0, 0, 0}, {3, 7, 7}));
+
+    amrex::Real error = amrex::ReduceMax(
+        out_mf[0], 0,
+        [=] AMREX_GPU_HOST_DEVICE(
+            amrex::Box const& bx,
+            amrex::Array4<amrex::Real const> const& farr) -> amrex::Real {
+            amrex::Real err = 0.0;
+            amrex::Loop(bx, [=, &err](int i, int j, int k) noexcept {
+                // Average of the fine cells
+                const amrex::Real ref =
+                    (2 * i + 0.5) + 2.0 * (2 * j + 0.5) + 4.0 * (2 * k + 0.5);
+                err = amrex::max(err, amrex::Math::abs(farr(i, j, k) - ref));
+            });
+            return err;
+        });
+    amrex::ParallelDescriptor::ReduceRealMax(error);
+    EXPECT_NEAR(error, 0.0, 1.0e-12);
+}
+
+} // namespace amr_wind_tests
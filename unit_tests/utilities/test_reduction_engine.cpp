@@ -0,0 +1,175 @@
+#include "aw_test_utils/MeshTest.H"
+
+#include "amr-wind/utilities/PostProcessing.H"
+#include "amr-wind/utilities/ReductionEngine.H"
+
+namespace amr_wind_tests {
+
+namespace {
+
+void init_field(amr_wind::Field& fld)
+{
+    const int nlevels = fld.repo().num_active_levels();
+
+    for (int lev = 0; lev < nlevels; ++lev) {
+        for (amrex::MFIter mfi(fld(lev)); mfi.isValid(); ++mfi) {
+            auto bx = mfi.validbox();
+            const auto& farr = fld(lev).array(mfi);
+
+            amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+                farr(i, j, k) = i + 2.0 * j - k;
+            });
+        }
+    }
+}
+
+struct FieldValueOp
+{
+    amrex::Array4<const amrex::Real> fld;
+
+    AMREX_GPU_DEVICE amrex::Real
+    operator()(const int i, const int j, const int k) const noexcept
+    {
+        return fld(i, j, k);
+    }
+};
+
+struct SquaredValueOp
+{
+    amrex::Array4<const amrex::Real> fld;
+    amrex::Real cell_vol;
+
+    AMREX_GPU_DEVICE amrex::Real
+    operator()(const int i, const int j, const int k) const noexcept
+    {
+        return cell_vol * fld(i, j, k) * fld(i, j, k);
+    }
+};
+
+//! Unmasked sum of the squared values computed one field at a time
+amrex::Real reference_squared_sum(const amr_wind::Field& fld)
+{
+    amrex::Real nrm = 0.0;
+    const int nlevels = fld.repo().num_active_levels();
+    const auto& geom = fld.repo().mesh().Geom();
+
+    for (int lev = 0; lev < nlevels; ++lev) {
+        const amrex::Real cell_vol = geom[lev].CellSize()[0] *
+                                     geom[lev].CellSize()[1] *
+                                     geom[lev].CellSize()[2];
+
+        nrm += amrex::ReduceSum(
+            fld(lev), 0,
+            [=] AMREX_GPU_HOST_DEVICE(
+                amrex::Box const& bx,
+                amrex::Array4<amrex::Real const> const& farr) -> amrex::Real {
+                amrex::Real nrm_fab = 0.0;
+                amrex::Loop(bx, [=, &nrm_fab](int i, int j, int k) noexcept {
+                    nrm_fab += cell_vol * farr(i, j, k) * farr(i, j, k);
+                });
+                return nrm_fab;
+            });
+    }
+    amrex::ParallelDescriptor::ReduceRealSum(nrm);
+    return nrm;
+}
+
+} // namespace
+
+class ReductionEngineTest : public MeshTest
+{
+protected:
+    void populate_parameters() override
+    {
+        MeshTest::populate_parameters();
+
+        {
+            amrex::ParmParse pp("amr");
+            amrex::Vector<int> ncell{{nx, nx, nx}};
+            pp.add("max_level", 0);
+            pp.add("max_grid_size", nx / 2);
+            pp.addarr("n_cell", ncell);
+        }
+        {
+            amrex::ParmParse pp("geometry");
+            amrex::Vector<amrex::Real> problo{{0.0, 0.0, 0.0}};
+            amrex::Vector<amrex::Real> probhi{{1.0, 1.0, 1.0}};
+            pp.addarr("prob_lo", problo);
+            pp.addarr("prob_hi", probhi);
+        }
+    }
+
+    const int nx = 8;
+};
+
+TEST_F(ReductionEngineTest, single_sweep)
+{
+    initialize_mesh();
+    auto& fld = sim().repo().declare_field("rtest", 1, 0);
+    init_field(fld);
+
+    auto factory = [&fld](const int lev, const amrex::MFIter& mfi) {
+        return FieldValueOp{fld(lev).const_array(mfi)};
+    };
+
+    using RType = amr_wind::ReductionEngine::ReduceType;
+    auto& engine = sim().post_manager().reductions();
+    const int qsum = engine.add(RType::Sum, 1, factory);
+    const int qmax = engine.add(RType::Max, 1, factory);
+    const int qmin = engine.add(RType::Min, 1, factory);
+
+    // Sum over i, j, k of (i + 2 j - k) on an nx^3 mesh
+    const amrex::Real isum = 0.5 * nx * (nx - 1);
+    const amrex::Real sum_ref = 2.0 * nx * nx * isum;
+    EXPECT_NEAR(engine.value(qsum), sum_ref, 1.0e-10);
+    EXPECT_NEAR(engine.value(qmax), 3.0 * (nx - 1), 1.0e-12);
+    EXPECT_NEAR(engine.value(qmin), -(nx - 1), 1.0e-12);
+
+    // All the quantities were evaluated together
+    EXPECT_EQ(engine.num_sweeps(), 1);
+    EXPECT_EQ(engine.num_mask_builds(), 1);
+
+    // A new sweep reuses the masks as long as the mesh is unchanged
+    engine.invalidate();
+    EXPECT_NEAR(engine.value(qmax), 3.0 * (nx - 1), 1.0e-12);
+    EXPECT_EQ(engine.num_sweeps(), 2);
+    EXPECT_EQ(engine.num_mask_builds(), 1);
+}
+
+TEST_F(ReductionEngineTest, unmasked_nodal_sum)
+{
+    initialize_mesh();
+    auto& repo = sim().repo();
+    auto& cc_fld = repo.declare_cc_field("cc_test", 1, 0);
+    auto& nd_fld = repo.declare_nd_field("nd_test", 1, 0);
+    init_field(cc_fld);
+    init_field(nd_fld);
+
+    using RType = amr_wind::ReductionEngine::ReduceType;
+    auto& engine = sim().post_manager().reductions();
+    amrex::Vector<int> qids;
+    for (auto* fld : {&cc_fld, &nd_fld}) {
+        const auto nodal =
+            amr_wind::field_impl::index_type(fld->field_location()).ixType();
+        qids.push_back(engine.add(
+            RType::Sum, 1,
+            [fld](const int lev, const amrex::MFIter& mfi) {
+                const auto& geom = fld->repo().mesh().Geom(lev);
+                return SquaredValueOp{
+                    (*fld)(lev).const_array(mfi),
+                    geom.CellSize()[0] * geom.CellSize()[1] *
+                        geom.CellSize()[2]};
+            },
+            false, nodal));
+    }
+
+    // The nodal sum includes the high-side nodes of every box
+    const amrex::Real cc_ref = reference_squared_sum(cc_fld);
+    const amrex::Real nd_ref = reference_squared_sum(nd_fld);
+    EXPECT_GT(nd_ref, cc_ref);
+    EXPECT_NEAR(engine.value(qids[0]), cc_ref, 1.0e-12 * cc_ref);
+    EXPECT_NEAR(engine.value(qids[1]), nd_ref, 1.0e-12 * nd_ref);
+    EXPECT_EQ(engine.num_sweeps(), 1);
+}
+
+} // namespace amr_wind_tests
@@ -4,6 +4,7 @@
 #include "amr-wind/utilities/sampling/Sampling.H"
 #include "amr-wind/utilities/sampling/SamplingContainer.H"
 #include "amr-wind/utilities/sampling/PlaneSampler.H"
+#include "amr-wind/utilities/sampling/LidarSampler.H"
 
 namespace amr_wind_tests {
 
@@ -48,6 +49,11 @@ public:
         : amr_wind::sampling::Sampling(sim, label)
     {}
 
+    amr_wind::sampling::SamplingContainer& container()
+    {
+        return sampling_container();
+    }
+
 protected:
     void prepare_netcdf_file() override {}
     void process_output() override
@@ -219,6 +225,87 @@ TEST_F(SamplingTest, sampling)
     probes.post_advance_work();
 }
 
+TEST_F(SamplingTest, moving_sampler)
+{
+    {
+        amrex::ParmParse pp("time");
+        pp.add("fixed_dt", 1.0);
+    }
+    initialize_mesh();
+    auto& repo = sim().repo();
+    auto& vel = repo.declare_field("velocity", 3, 2);
+    init_field(vel);
+
+    {
+        amrex::ParmParse pp("sampling");
+        pp.add("output_frequency", 1);
+        pp.addarr("labels", amrex::Vector<std::string>{"line1", "lidar1"});
+        pp.addarr("fields", amrex::Vector<std::string>{"velocity"});
+    }
+    {
+        amrex::ParmParse pp("sampling.line1");
+        pp.add("type", std::string("LineSampler"));
+        pp.add("num_points", 16);
+        pp.addarr("start", amrex::Vector<amrex::Real>{66.0, 66.0, 1.0});
+        pp.addarr("end", amrex::Vector<amrex::Real>{66.0, 66.0, 127.0});
+    }
+    {
+        amrex::ParmParse pp("sampling.lidar1");
+        pp.add("type", std::string("LidarSampler"));
+        pp.add("num_points", 8);
+        pp.add("length", 50.0);
+        pp.addarr("origin", amrex::Vector<amrex::Real>{64.0, 64.0, 64.0});
+        pp.addarr("time_table", amrex::Vector<amrex::Real>{0.0, 4.0});
+        pp.addarr("azimuth_table", amrex::Vector<amrex::Real>{0.0, 180.0});
+        pp.addarr("elevation_table", amrex::Vector<amrex::Real>{0.0, 0.0});
+        pp.add("periodic", false);
+    }
+
+    SamplingImpl probes(sim(), "sampling");
+    probes.initialize();
+
+    amr_wind::sampling::LidarSampler lidar(sim());
+    amr_wind::sampling::LineSampler line(sim());
+    amr_wind::sampling::SamplerBase::SampleLocType lidar_locs, line_locs;
+    line.initialize("sampling.line1");
+    line.sampling_locations(line_locs);
+
+    using ParIter = amr_wind::sampling::SamplingContainer::ParIterType;
+    for (int nstep = 0; nstep < 3; ++nstep) {
+        sim().time().new_timestep();
+        sim().time().set_current_cfl(0.1, 0.0, 0.0);
+        probes.post_advance_work();
+
+        lidar.initialize("sampling.lidar1");
+        lidar.sampling_locations(lidar_locs);
+
+        // The particles must track the current sampling locations
+        int counter = 0;
+        auto& sc = probes.container();
+        for (ParIter pti(sc, 0); pti.isValid(); ++pti) {
+            const int np = pti.numParticles();
+            const auto& pvec = pti.GetArrayOfStructs()();
+            amrex::Gpu::HostVector<
+                amr_wind::sampling::SamplingContainer::ParticleType>
+                hvec(np);
+            amrex::Gpu::copy(
+                amrex::Gpu::deviceToHost, pvec.begin(), pvec.end(),
+                hvec.begin());
+            for (const auto& pp : hvec) {
+                const int sid = pp.idata(amr_wind::sampling::IIx::sid);
+                const int nid = pp.idata(amr_wind::sampling::IIx::nid);
+                const auto& locs = (sid == 0) ? line_locs : lidar_locs;
+                for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+                    EXPECT_NEAR(pp.pos(d), locs[nid][d], 1.0e-12);
+                }
+                ++counter;
+            }
+        }
+        amrex::ParallelDescriptor::ReduceIntSum(counter);
+        EXPECT_EQ(counter, 16 + 8);
+    }
+}
+
 TEST_F(SamplingTest, plane_sampler)
 {
     initialize_mesh();
@@ -0,0 +1,56 @@
+#include "aw_test_utils/AmrexTest.H"
+
+#include "amr-wind/utilities/TaskScheduler.H"
+
+#include <atomic>
+#include <stdexcept>
+
+namespace amr_wind_tests {
+
+TEST(TaskScheduler, nested_tasks)
+{
+    constexpr int num_tasks = 200;
+    constexpr int num_children = 16;
+    amr_wind::TaskScheduler tasks(4);
+    EXPECT_EQ(tasks.num_threads(), 4);
+
+    std::atomic<int> count{0};
+    for (int i = 0; i < num_tasks; ++i) {
+        tasks.submit([&]() {
+            for (int j = 0; j < num_children; ++j) {
+                tasks.submit([&]() { ++count; });
+            }
+            ++count;
+        });
+    }
+    tasks.wait();
+    EXPECT_EQ(tasks.num_pending(), 0);
+    EXPECT_EQ(count.load(), num_tasks * (num_children + 1));
+}
+
+TEST(TaskScheduler, exceptions)
+{
+    amr_wind::TaskScheduler tasks(2);
+    std::atomic<int> count{0};
+    tasks.submit([]() { throw std::runtime_error("task failed"); });
+    tasks.submit([&]() { ++count; });
+    EXPECT_THROW(tasks.wait(), std::runtime_error);
+    EXPECT_EQ(count.load(), 1);
+
+    // The error is only reported once
+    tasks.submit([&]() { ++count; });
+    EXPECT_NO_THROW(tasks.wait());
+    EXPECT_EQ(count.load(), 2);
+}
+
+TEST(TaskScheduler, serial_execution)
+{
+    amr_wind::TaskScheduler tasks(0);
+    int count = 0;
+    tasks.submit([&]() { ++count; });
+    // Tasks are executed immediately without worker threads
+    EXPECT_EQ(count, 1);
+    tasks.wait();
+}
+
+} // namespace amr_wind_tests
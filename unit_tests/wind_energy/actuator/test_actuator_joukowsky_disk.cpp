@@ -205,4 +205,37 @@ TEST_F(ActJoukowskyTest, execution)
     act.pre_init_actions();
     act.post_init_actions();
 }
-} // namespace amr_wind_tests
\ No newline at end of file
+
+TEST_F(ActJoukowskyTest, cached_spreading_matches_direct)
+{
+    intialize_domain();
+    basic_disk_setup();
+    add_actuators("TestJoukowskyDisk", {"D1"});
+    auto& src = sim().repo().get_field("actuator_src_term");
+    amrex::MultiFab direct(
+        src(0).boxArray(), src(0).DistributionMap(), src.num_comp(), 0);
+    {
+        amrex::ParmParse pp("Actuator.TestJoukowskyDisk");
+        pp.add("cache_spreading", false);
+        ActPhysicsTest act(sim());
+        act.pre_init_actions();
+        act.post_init_actions();
+        amrex::MultiFab::Copy(direct, src(0), 0, 0, src.num_comp(), 0);
+    }
+
+    amrex::ParmParse pp("Actuator.TestJoukowskyDisk");
+    pp.add("cache_spreading", true);
+    ActPhysicsTest act(sim());
+    act.pre_init_actions();
+    act.post_init_actions();
+    // second evaluation reuses the stencils built during initialization
+    act.pre_advance_work();
+
+    const amrex::Real ref_max = direct.norm0(0);
+    EXPECT_GT(ref_max, 0.0);
+    amrex::MultiFab::Subtract(direct, src(0), 0, 0, src.num_comp(), 0);
+    for (int n = 0; n < src.num_comp(); ++n) {
+        EXPECT_NEAR(direct.norm0(n), 0.0, 1.0e-12 * ref_max) << "comp: " << n;
+    }
+}
+} // namespace amr_wind_tests
@@ -2,7 +2,10 @@
 
 #include "amr-wind/wind_energy/actuator/aero/AirfoilTable.H"
 #include "amr-wind/utilities/trig_ops.H"
+#include "amr-wind/utilities/linear_interpolation.H"
 
+#include <cstdio>
+#include <fstream>
 #include <string>
 
 namespace amr_wind_tests {
@@ -92,4 +95,125 @@ TEST(Airfoil, airfoil_lookup)
     }
 }
 
+TEST(Airfoil, uniform_table)
+{
+    namespace interp = ::amr_wind::interp;
+    using AirfoilLoader = ::amr_wind::actuator::AirfoilLoader;
+
+    // Entries every 5 degrees except one 10 degree gap
+    auto ss = generate_openfast_airfoil();
+    auto af = AirfoilLoader::load_openfast_airfoil(ss);
+    EXPECT_EQ(af->num_uniform_entries(), 7);
+
+    // Entries that are not aligned with the smallest spacing
+    std::stringstream ss_fine;
+    ss_fine << 4 << std::endl
+            << "0.0 0.0 0.01 0.0\n1.0 0.1 0.02 -0.01\n"
+            << "2.5 0.3 0.04 -0.02\n4.0 0.2 0.08 -0.05" << std::endl;
+    auto af_fine = AirfoilLoader::load_text_file(ss_fine);
+    EXPECT_EQ(af_fine->num_uniform_entries(), 9);
+
+    // The uniform tables reproduce the interpolation of the input tables
+    for (const auto* tab : {af.get(), af_fine.get()}) {
+        const amrex::Real amin = tab->aoa().front() - 0.1;
+        const amrex::Real amax = tab->aoa().back() + 0.1;
+        constexpr int npts = 101;
+        for (int i = 0; i < npts; ++i) {
+            const amrex::Real aoa = amin + (amax - amin) * i / (npts - 1);
+            const auto ref = interp::linear(tab->aoa(), tab->polars(), aoa);
+            amrex::Real cl, cd, cm;
+            (*tab)(aoa, cl, cd, cm);
+            EXPECT_NEAR(cl, ref.x(), 1.0e-12);
+            EXPECT_NEAR(cd, ref.y(), 1.0e-12);
+            EXPECT_NEAR(cm, ref.z(), 1.0e-12);
+        }
+    }
+}
+
+TEST(Airfoil, non_uniform_table)
+{
+    namespace interp = ::amr_wind::interp;
+    using AirfoilLoader = ::amr_wind::actuator::AirfoilLoader;
+
+    auto ss = generate_openfast_airfoil();
+    auto af = AirfoilLoader::load_openfast_airfoil(ss);
+    EXPECT_TRUE(af->uniform_is_exact());
+
+    // Entries that are not aligned with any refinement of the smallest spacing
+    std::stringstream ss_irr;
+    ss_irr << 4 << std::endl
+           << "0.0 0.0 0.01 0.0\n1.0 0.1 0.02 -0.01\n"
+           << "2.7182818 0.3 0.04 -0.02\n4.0 0.2 0.08 -0.05" << std::endl;
+    auto af_irr = AirfoilLoader::load_text_file(ss_irr);
+    EXPECT_FALSE(af_irr->uniform_is_exact());
+
+    // Spacings that would exceed the maximum size of the uniform table
+    std::stringstream ss_cap;
+    ss_cap << 3 << std::endl
+           << "0.0 0.0 0.01 0.0\n1.0e-5 0.1 0.02 -0.01\n"
+           << "10.0 0.3 0.04 -0.02" << std::endl;
+    auto af_cap = AirfoilLoader::load_text_file(ss_cap);
+    EXPECT_FALSE(af_cap->uniform_is_exact());
+
+    // The host lookups interpolate the input tables
+    for (const auto* tab : {af_irr.get(), af_cap.get()}) {
+        const amrex::Real amin = tab->aoa().front() - 0.1;
+        const amrex::Real amax = tab->aoa().back() + 0.1;
+        constexpr int npts = 101;
+        for (int i = 0; i < npts; ++i) {
+            const amrex::Real aoa = amin + (amax - amin) * i / (npts - 1);
+            const auto ref = interp::linear(tab->aoa(), tab->polars(), aoa);
+            amrex::Real cl, cd, cm;
+            (*tab)(aoa, cl, cd, cm);
+            EXPECT_NEAR(cl, ref.x(), 1.0e-12);
+            EXPECT_NEAR(cd, ref.y(), 1.0e-12);
+            EXPECT_NEAR(cm, ref.z(), 1.0e-12);
+        }
+    }
+}
+
+TEST(Airfoil, shared_loader)
+{
+    using AirfoilLoader = ::amr_wind::actuator::AirfoilLoader;
+    const std::string fname = "shared_loader_airfoil.dat";
+    const std::string cache_file = fname + ".awbin";
+    if (amrex::ParallelDescriptor::IOProcessor()) {
+        std::ofstream fh(fname);
+        fh << generate_openfast_airfoil().str();
+        std::remove(cache_file.c_str());
+    }
+    amrex::ParallelDescriptor::Barrier();
+
+    AirfoilLoader::clear_cache();
+    auto af_ref = AirfoilLoader::load_openfast_airfoil(fname);
+    auto af1 = AirfoilLoader::load_airfoil(fname, "openfast", true);
+    auto af2 = AirfoilLoader::load_airfoil(fname, "OpenFAST");
+    EXPECT_EQ(AirfoilLoader::num_cached_airfoils(), 1);
+    EXPECT_TRUE(std::ifstream(cache_file).good());
+
+    // Reload the table from the binary cache
+    AirfoilLoader::clear_cache();
+    EXPECT_EQ(AirfoilLoader::num_cached_airfoils(), 0);
+    auto af3 = AirfoilLoader::load_airfoil(fname, "openfast", true);
+
+    for (const auto* af : {af1.get(), af2.get(), af3.get()}) {
+        ASSERT_EQ(af->num_entries(), af_ref->num_entries());
+        EXPECT_EQ(af->num_uniform_entries(), af_ref->num_uniform_entries());
+        for (int i = 0; i < af_ref->num_entries(); ++i) {
+            EXPECT_NEAR(af->aoa()[i], af_ref->aoa()[i], 1.0e-12);
+            for (int n = 0; n < AMREX_SPACEDIM; ++n) {
+                EXPECT_NEAR(
+                    af->polars()[i][n], af_ref->polars()[i][n], 1.0e-12);
+            }
+        }
+    }
+
+    AirfoilLoader::clear_cache();
+    amrex::ParallelDescriptor::Barrier();
+    if (amrex::ParallelDescriptor::IOProcessor()) {
+        std::remove(fname.c_str());
+        std::remove(cache_file.c_str());
+    }
+}
+
 } // namespace amr_wind_tests
@@ -0,0 +1,161 @@
+#include "aw_test_utils/MeshTest.H"
+
+#include "amr-wind/wind_energy/actuator/disk/disk_spreading_cache.H"
+
+namespace amr_wind_tests {
+
+namespace {
+
+namespace act = amr_wind::actuator;
+namespace vs = amr_wind::vs;
+
+//! Projection weight with a compact support around each force point
+struct HatWeight
+{
+    const vs::Vector* pos;
+    amrex::Real radius;
+
+    AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE amrex::Real
+    operator()(const vs::Vector& cc, const int ip) const noexcept
+    {
+        return amrex::max<amrex::Real>(
+            0.0, 1.0 - vs::mag(cc - pos[ip]) / radius);
+    }
+};
+
+void spread_cached(
+    act::ops::SpreadingCache& cache,
+    amr_wind::Field& src,
+    const HatWeight& wfunc,
+    const int npts,
+    const vs::Vector* force)
+{
+    src.setVal(0.0);
+    const int nlevels = src.repo().num_active_levels();
+    for (int lev = 0; lev < nlevels; ++lev) {
+        const auto& geom = src.repo().mesh().Geom(lev);
+        for (amrex::MFIter mfi(src(lev)); mfi.isValid(); ++mfi) {
+            cache.spread(
+                lev, mfi, geom, wfunc, npts, force, src(lev).array(mfi));
+        }
+    }
+}
+
+void spread_direct(
+    amr_wind::Field& src,
+    const HatWeight& wfunc,
+    const int npts,
+    const vs::Vector* force)
+{
+    src.setVal(0.0);
+    const int nlevels = src.repo().num_active_levels();
+    for (int lev = 0; lev < nlevels; ++lev) {
+        const auto& geom = src.repo().mesh().Geom(lev);
+        const auto& problo = geom.ProbLoArray();
+        const auto& dx = geom.CellSizeArray();
+        for (amrex::MFIter mfi(src(lev)); mfi.isValid(); ++mfi) {
+            const auto& sarr = src(lev).array(mfi);
+            amrex::ParallelFor(
+                mfi.tilebox(),
+                [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                    const vs::Vector cc{
+                        problo[0] + (i + 0.5) * dx[0],
+                        problo[1] + (j + 0.5) * dx[1],
+                        problo[2] + (k + 0.5) * dx[2],
+                    };
+                    for (int ip = 0; ip < npts; ++ip) {
+                        const amrex::Real wt = wfunc(cc, ip);
+                        sarr(i, j, k, 0) += wt * force[ip].x();
+                        sarr(i, j, k, 1) += wt * force[ip].y();
+                        sarr(i, j, k, 2) += wt * force[ip].z();
+                    }
+                });
+        }
+    }
+}
+
+} // namespace
+
+class DiskSpreadingCacheTest : public MeshTest
+{
+protected:
+    void populate_parameters() override
+    {
+        MeshTest::populate_parameters();
+
+        {
+            amrex::ParmParse pp("amr");
+            amrex::Vector<int> ncell{{32, 32, 32}};
+            pp.add("max_level", 0);
+            pp.add("max_grid_size", 8);
+            pp.addarr("n_cell", ncell);
+        }
+        {
+            amrex::ParmParse pp("geometry");
+            amrex::Vector<amrex::Real> problo{{0.0, 0.0, 0.0}};
+            amrex::Vector<amrex::Real> probhi{{32.0, 32.0, 32.0}};
+            pp.addarr("prob_lo", problo);
+            pp.addarr("prob_hi", probhi);
+        }
+    }
+};
+
+TEST_F(DiskSpreadingCacheTest, reuse_stencils)
+{
+    initialize_mesh();
+    auto& repo = sim().repo();
+    auto& src = repo.declare_field("src", 3, 0);
+    auto& ref = repo.declare_field("ref", 3, 0);
+
+    act::VecList pos{
+        {16.2, 16.1, 15.7}, {16.2, 17.3, 15.7}, {16.2, 14.9, 15.7}};
+    const act::VecList h_force{
+        {1.0, 0.5, 0.0}, {2.0, 0.0, 1.0}, {0.5, 1.0, 1.0}};
+    const int npts = static_cast<int>(pos.size());
+    act::DeviceVecList d_pos(npts), d_force(npts);
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, h_force.begin(), h_force.end(),
+        d_force.begin());
+    const HatWeight wfunc{d_pos.data(), 2.0};
+
+    act::ops::SpreadingCache cache;
+    int num_builds = 0;
+    for (int step = 0; step < 4; ++step) {
+        // Move the points before the last step
+        if (step == 3) {
+            for (auto& p : pos) {
+                p.x() += 1.0;
+            }
+        }
+        amrex::Gpu::copy(
+            amrex::Gpu::hostToDevice, pos.begin(), pos.end(), d_pos.begin());
+        cache.update(pos, src);
+        spread_cached(cache, src, wfunc, npts, d_force.data());
+        spread_direct(ref, wfunc, npts, d_force.data());
+
+        if (step == 0) {
+            num_builds = cache.num_builds();
+            EXPECT_EQ(num_builds, src(0).local_size());
+        } else if (step < 3) {
+            // The stencils are reused while the points do not move
+            EXPECT_EQ(cache.num_builds(), num_builds);
+        } else {
+            EXPECT_EQ(cache.num_builds(), 2 * num_builds);
+        }
+
+        const amrex::Real ref_max = ref(0).norm0(0);
+        EXPECT_GT(ref_max, 0.0);
+        amrex::MultiFab::Subtract(ref(0), src(0), 0, 0, 3, 0);
+        for (int n = 0; n < 3; ++n) {
+            EXPECT_NEAR(ref(0).norm0(n), 0.0, 1.0e-12 * ref_max);
+        }
+    }
+
+    // Only the cells around the points are stored
+    amrex::Long num_cells = cache.num_stencil_cells();
+    amrex::ParallelDescriptor::ReduceLongSum(num_cells);
+    EXPECT_GT(num_cells, 0);
+    EXPECT_LT(num_cells, 1000);
+}
+
+} // namespace amr_wind_tests
@@ -14,6 +14,7 @@
 #include "amr-wind/equation_systems/icns/source_terms/CoriolisForcing.H"
 #include "amr-wind/equation_systems/icns/source_terms/BoussinesqBuoyancy.H"
 #include "amr-wind/equation_systems/icns/source_terms/DensityBuoyancy.H"
+#include "amr-wind/equation_systems/icns/source_terms/GravityForcing.H"
 
 namespace amr_wind_tests {
 
@@ -491,4 +492,65 @@ TEST_F(ABLMeshTest, densitybuoyancy)
     EXPECT_NEAR(utils::field_max(src_term, 2), -9.81 * (1.0 - 1.0 / 0.5), tol);
 }
 
+TEST_F(ABLMeshTest, fused_source_terms)
+{
+    constexpr int kdim = 7;
+    utils::populate_abl_params();
+    initialize_mesh();
+
+    auto& pde_mgr = sim().pde_manager();
+    pde_mgr.register_icns();
+    pde_mgr.register_transport_pde("Temperature");
+    sim().init_physics();
+    sim().time().current_time() = 0.1;
+
+    auto& temperature =
+        sim().repo().get_field("temperature", amr_wind::FieldState::Old);
+    run_algorithm(temperature, [&](const int lev, const amrex::MFIter& mfi) {
+        const auto bx = mfi.validbox();
+        const auto& temp_arr = temperature(lev).array(mfi);
+        init_abl_temperature_field(kdim, bx, temp_arr);
+    });
+
+    using MomSrcPtr = std::unique_ptr<amr_wind::pde::MomentumSource>;
+    amrex::Vector<MomSrcPtr> sources;
+    for (const auto* name :
+         {"BodyForce", "BoussinesqBuoyancy", "CoriolisForcing", "BodyForce",
+          "GravityForcing"}) {
+        sources.emplace_back(
+            amr_wind::pde::MomentumSource::create(name, sim()));
+    }
+
+    amr_wind::pde::FusedSources<amr_wind::pde::ICNS>::type fused;
+    fused.init(sources);
+    // A repeated source term type starts a new kernel
+    EXPECT_EQ(fused.num_stages(), 2);
+    EXPECT_EQ(fused.num_fused(), 5);
+
+    auto& src_term = pde_mgr.icns().fields().src_term;
+    auto& src_ref = sim().repo().declare_field("src_ref", AMREX_SPACEDIM);
+    src_term.setVal(0.0);
+    src_ref.setVal(0.0);
+    run_algorithm(src_term, [&](const int lev, const amrex::MFIter& mfi) {
+        const auto& bx = mfi.tilebox();
+        const auto fstate = amr_wind::FieldState::Old;
+        fused(sources, lev, mfi, bx, fstate, src_term(lev).array(mfi));
+
+        const auto& ref_arr = src_ref(lev).array(mfi);
+        for (const auto& src : sources) {
+            (*src)(lev, mfi, bx, fstate, ref_arr);
+        }
+    });
+
+    // Fused evaluation must be identical to the sequential evaluation
+    for (int lev = 0; lev < mesh().num_levels(); ++lev) {
+        amrex::MultiFab::Subtract(
+            src_ref(lev), src_term(lev), 0, 0, AMREX_SPACEDIM, 0);
+    }
+    for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+        EXPECT_EQ(utils::field_min(src_ref, i), 0.0);
+        EXPECT_EQ(utils::field_max(src_ref, i), 0.0);
+    }
+}
+
 } // namespace amr_wind_tests
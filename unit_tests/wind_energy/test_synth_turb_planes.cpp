@@ -0,0 +1,139 @@
+#include "gtest/gtest.h"
+#include "amr-wind/physics/SyntheticTurbulence.H"
+#include "amr-wind/utilities/ncutils/nc_interface.H"
+#include "AMReX_ParallelDescriptor.H"
+
+namespace amr_wind_tests {
+namespace {
+
+constexpr int nx = 12;
+constexpr int ny = 4;
+constexpr int nz = 3;
+
+double turb_value(const int i, const int j, const int k, const int n)
+{
+    return (n + 1) * (1000.0 * i + 10.0 * j + k);
+}
+
+void write_turb_file(const std::string& fname)
+{
+    if (!amrex::ParallelDescriptor::IOProcessor()) {
+        return;
+    }
+
+    auto ncf = ncutils::NCFile::create(fname, NC_CLOBBER | NC_NETCDF4);
+    ncf.def_dim("ndim", 3);
+    ncf.def_dim("nx", nx);
+    ncf.def_dim("ny", ny);
+    ncf.def_dim("nz", nz);
+    const std::vector<std::string> three_dim{"nx", "ny", "nz"};
+    auto lengths = ncf.def_var("box_lengths", NC_DOUBLE, {"ndim"});
+    auto dx = ncf.def_var("dx", NC_DOUBLE, {"ndim"});
+    const amrex::Vector<std::string> vnames{"uvel", "vvel", "wvel"};
+    for (const auto& vname : vnames) {
+        ncf.def_var(vname, NC_DOUBLE, three_dim);
+    }
+
+    const std::vector<double> box_len{12.0, 4.0, 3.0};
+    const std::vector<double> box_dx{1.0, 1.0, 1.0};
+    lengths.put(box_len.data());
+    dx.put(box_dx.data());
+
+    std::vector<double> buf(nx * ny * nz);
+    for (int n = 0; n < 3; ++n) {
+        for (int i = 0; i < nx; ++i) {
+            for (int j = 0; j < ny; ++j) {
+                for (int k = 0; k < nz; ++k) {
+                    buf[(i * ny + j) * nz + k] = turb_value(i, j, k, n);
+                }
+            }
+        }
+        ncf.var(vnames[n]).put(buf.data());
+    }
+}
+
+void check_planes(
+    const amr_wind::SynthTurbData& turb_grid, const int il, const int ir)
+{
+    const int planes[2]{il, ir};
+    for (int p = 0; p < 2; ++p) {
+        for (int j = 0; j < ny; ++j) {
+            for (int k = 0; k < nz; ++k) {
+                for (int n = 0; n < 3; ++n) {
+                    const size_t idx = ((p * ny + j) * nz + k) * 3 + n;
+                    EXPECT_EQ(
+                        turb_grid.vel[idx], turb_value(planes[p], j, k, n));
+                }
+            }
+        }
+    }
+}
+
+} // namespace
+
+TEST(SyntheticTurbulence, prefetch_planes)
+{
+    const std::string fname = "synth_turb_planes.nc";
+    write_turb_file(fname);
+    amrex::ParallelDescriptor::Barrier();
+
+    amr_wind::SynthTurbData direct;
+    amr_wind::SynthTurbData prefetched;
+    prefetched.prefetch_planes = true;
+    amr_wind::synth_turb::process_nc_file(fname, direct);
+    amr_wind::synth_turb::process_nc_file(fname, prefetched);
+    ASSERT_EQ(prefetched.box_dims[0], nx);
+
+    // Advance one plane at a time, then jump by several planes, wrap around
+    // the end of the box, and finally jump by a different number of planes
+    const amrex::Vector<int> left_planes{0, 1, 2, 5, 8, 11, 3};
+    for (const int il : left_planes) {
+        const int ir = (il + 1) % nx;
+        amr_wind::synth_turb::load_turb_plane_data(fname, direct, il, ir);
+        amr_wind::synth_turb::load_turb_plane_data(fname, prefetched, il, ir);
+        EXPECT_EQ(prefetched.vel, direct.vel);
+        check_planes(prefetched, il, ir);
+    }
+
+    if (amrex::ParallelDescriptor::IOProcessor()) {
+        EXPECT_EQ(prefetched.num_prefetch_hits, 4);
+        EXPECT_EQ(prefetched.num_prefetch_misses, 2);
+    }
+}
+
+TEST(SyntheticTurbulence, prefetch_concurrent_io)
+{
+    const std::string fname = "synth_turb_planes_io.nc";
+    write_turb_file(fname);
+    amrex::ParallelDescriptor::Barrier();
+
+    amr_wind::SynthTurbData turb_grid;
+    turb_grid.prefetch_planes = true;
+    amr_wind::synth_turb::process_nc_file(fname, turb_grid);
+
+    for (int il = 0; il < 4; ++il) {
+        // Write and read back another file on the main thread while the next
+        // planes are read in the background
+        amr_wind::synth_turb::load_turb_plane_data(
+            fname, turb_grid, il, il + 1);
+        const std::string other =
+            "synth_turb_planes_io_" + std::to_string(il) + ".nc";
+        write_turb_file(other);
+        check_planes(turb_grid, il, il + 1);
+
+        if (amrex::ParallelDescriptor::IOProcessor()) {
+            auto ncf = ncutils::NCFile::open(other, NC_NOWRITE);
+            std::vector<double> box_len(3);
+            ncf.var("box_lengths").get(box_len.data());
+            EXPECT_EQ(box_len[0], 12.0);
+            EXPECT_EQ(ncf.dim("nx").len(), static_cast<size_t>(nx));
+        }
+    }
+
+    if (amrex::ParallelDescriptor::IOProcessor()) {
+        EXPECT_EQ(turb_grid.num_prefetch_hits, 3);
+        EXPECT_EQ(turb_grid.num_prefetch_misses, 0);
+    }
+}
+
+} // namespace amr_wind_tests